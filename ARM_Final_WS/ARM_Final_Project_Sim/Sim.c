@@ -0,0 +1,1611 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Sim.c                                                                     *
+ * [DESCRIPTION]    :           Source file for the host simulation of the TM4C123GH6PM - virtual time    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Sim.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define SIM_NEVER                     0xFFFFFFFFFFFFFFFFULL
+
+/* Clock periods in picoseconds */
+#define SIM_PLL_PERIOD                2500ULL         /* 400 MHz */
+#define SIM_PIOSC_PERIOD              62500ULL        /* 16 MHz */
+#define SIM_PIOSC_4_PERIOD            250000ULL       /* SysTick alternate clock */
+
+/* Stacking of the exception frame */
+#define SIM_EXCEPTION_ENTRY_CYCLES    12
+
+#define SIM_THREAD_PRIORITY           0x100
+#define SIM_PRIORITY_MASK             0xE0
+#define SIM_MAX_NESTING               SIM_VECTORS_COUNT
+#define SIM_IRQ_WORDS                 5
+
+/* System Control Space */
+#define SIM_SYSTICK_CTRL              0xE000E010
+#define SIM_SYSTICK_RELOAD            0xE000E014
+#define SIM_SYSTICK_CURRENT           0xE000E018
+#define SIM_NVIC_EN0                  0xE000E100
+#define SIM_NVIC_DIS0                 0xE000E180
+#define SIM_NVIC_PEND0                0xE000E200
+#define SIM_NVIC_UNPEND0              0xE000E280
+#define SIM_NVIC_ACTIVE0              0xE000E300
+#define SIM_NVIC_PRI0                 0xE000E400
+#define SIM_NVIC_SWTRIG               0xE000EF00
+#define SIM_SCB_ICSR                  0xE000ED04
+#define SIM_SCB_VTOR                  0xE000ED08
+#define SIM_SCB_APINT                 0xE000ED0C
+#define SIM_SCB_SCR                   0xE000ED10
+#define SIM_SCB_SHPR3                 0xE000ED20
+#define SIM_MPU_TYPE                  0xE000ED90
+#define SIM_DWT_CTRL                  0xE0001000
+#define SIM_DWT_CYCCNT                0xE0001004
+#define SIM_DEBUG_DEMCR               0xE000EDFC
+
+#define SIM_STCTRL_ENABLE             0x00000001
+#define SIM_STCTRL_INTEN              0x00000002
+#define SIM_STCTRL_CLK_SRC            0x00000004
+#define SIM_STCTRL_COUNT              0x00010000
+#define SIM_STRELOAD_MASK             0x00FFFFFF
+#define SIM_ICSR_PENDSVSET            0x10000000
+#define SIM_ICSR_PENDSVCLR            0x08000000
+#define SIM_ICSR_PENDSTSET            0x04000000
+#define SIM_ICSR_PENDSTCLR            0x02000000
+#define SIM_APINT_VECTKEY             0x05FA
+#define SIM_APINT_VECTKEYSTAT         0xFA050000
+#define SIM_APINT_PRIGROUP_BITS_POS   8
+#define SIM_SCR_SLEEPDEEP             0x00000004
+#define SIM_DWT_CYCCNTENA             0x00000001
+#define SIM_DEMCR_TRCENA              0x01000000
+
+/* System control */
+#define SIM_SYSCTL_RIS                0x400FE050
+#define SIM_SYSCTL_RCC2               0x400FE070
+#define SIM_SYSCTL_PLLSTAT            0x400FE168
+#define SIM_SYSCTL_RCGC_FIRST         0x400FE600
+#define SIM_SYSCTL_PR_FIRST           0x400FEA00
+#define SIM_SYSCTL_PR_LAST            0x400FEA5C
+#define SIM_SYSCTL_READY_FLAGS        0x00000140      /* MOSC powered up and PLL locked */
+#define SIM_RCC2_USERCC2              0x80000000
+#define SIM_RCC2_DIV400               0x40000000
+#define SIM_RCC2_BYPASS2              0x00000800
+#define SIM_RCC2_SYSDIV2_BITS_POS     22
+#define SIM_RCC2_SYSDIV2_MASK         0x7F
+
+/* Size of the register block of a peripheral */
+#define SIM_BLOCK_SIZE                0x1000
+
+/* GPIO, the APB and AHB apertures share the port state */
+#define SIM_GPIO_AHB_BASE             0x40058000
+#define SIM_GPIO_DATA_LAST            0x3FC
+#define SIM_GPIO_DIR                  0x400
+#define SIM_GPIO_IS                   0x404
+#define SIM_GPIO_IBE                  0x408
+#define SIM_GPIO_IEV                  0x40C
+#define SIM_GPIO_IM                   0x410
+#define SIM_GPIO_RIS                  0x414
+#define SIM_GPIO_MIS                  0x418
+#define SIM_GPIO_ICR                  0x41C
+
+/* UART0 */
+#define SIM_UART0_BASE                0x4000C000
+#define SIM_UART0_IRQ                 5
+#define SIM_UART_DR                   0x000
+#define SIM_UART_FR                   0x018
+#define SIM_UART_CTL                  0x030
+#define SIM_UART_IFLS                 0x034
+#define SIM_UART_IM                   0x038
+#define SIM_UART_RIS                  0x03C
+#define SIM_UART_MIS                  0x040
+#define SIM_UART_ICR                  0x044
+#define SIM_UART_DMACTL               0x048
+#define SIM_UART_FR_RXFE              0x00000010
+#define SIM_UART_FR_TXFE              0x00000080
+#define SIM_UART_INT_RX               0x00000010
+#define SIM_UART_INT_RT               0x00000040
+#define SIM_UART_INT_OE               0x00000400
+#define SIM_UART_CTL_ENABLED          0x00000101      /* UARTEN and TXE */
+#define SIM_UART_DMACTL_TXDMAE        0x00000002
+#define SIM_UART_FIFO_SIZE            16
+/* A read value of DR is marked so a write of the same byte is detected (bits 31:12 are reserved) */
+#define SIM_UART_DR_READ_MARK         0x80000000
+
+/* uDMA */
+#define SIM_UDMA_BASE                 0x400FF000
+#define SIM_UDMA_SOFTWARE_IRQ         46
+#define SIM_UDMA_CHANNELS             32
+#define SIM_UDMA_CTLBASE              0x008
+#define SIM_UDMA_SWREQ                0x014
+#define SIM_UDMA_USEBURSTSET          0x018
+#define SIM_UDMA_REQMASKSET           0x020
+#define SIM_UDMA_ENASET               0x028
+#define SIM_UDMA_ALTSET               0x030
+#define SIM_UDMA_PRIOSET              0x038
+#define SIM_UDMA_CHIS                 0x504
+#define SIM_UDMA_UART0_CHANNELS       0x00000300      /* Channels 8 (RX) and 9 (TX) */
+#define SIM_UDMA_UART0_TX_CHANNEL     9
+#define SIM_UDMA_MODE_MASK            0x00000007
+#define SIM_UDMA_XFERSIZE_BITS_POS    4
+#define SIM_UDMA_XFERSIZE_MASK        0x000003FF
+#define SIM_UDMA_SRCSIZE_BITS_POS     24
+#define SIM_UDMA_SRCINC_BITS_POS      26
+#define SIM_UDMA_DSTINC_BITS_POS      30
+#define SIM_UDMA_INC_NONE             3
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    SIM_UDMA_MODE_STOP,
+    SIM_UDMA_MODE_BASIC,
+    SIM_UDMA_MODE_AUTO,
+    SIM_UDMA_MODE_PING_PONG,
+    SIM_UDMA_MODE_MEMORY_SG,
+    SIM_UDMA_MODE_MEMORY_SG_ALTERNATE,
+    SIM_UDMA_MODE_PERIPHERAL_SG,
+    SIM_UDMA_MODE_PERIPHERAL_SG_ALTERNATE
+}Sim_UdmaModeType;
+
+/* Control structure as laid out by Udma.c */
+typedef struct
+{
+    uint32 SourceEnd;
+    uint32 DestinationEnd;
+    uint32 Control;
+    uint32 Spare;
+}Sim_UdmaControlType;
+
+typedef struct
+{
+    uint64 Time;
+    Sim_EventKindType Kind;
+    Sim_PortType Port;
+    uint8 Pin;
+    uint8 Value;
+}Sim_EventType;
+
+typedef struct
+{
+    uint8 Input;            /* Levels driven by the scenario */
+    uint8 Output;           /* Output latch written through DATA */
+    uint8 EdgeStatus;       /* Edges latched in RIS */
+    uint8 Observed;         /* Last output levels given to the observer */
+}Sim_GpioType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* One host word per register ... static so their addresses fit in 32 bits (the build is not PIE) */
+static uint32 g_Sim_Peripherals[SIM_RANGE_SIZE / 4];
+static uint32 g_Sim_System[SIM_RANGE_SIZE / 4];
+
+/* Register returned by the last access, and its value when it was returned */
+static uint32 g_Sim_LastAddress = 0;
+static uint32 *g_Sim_LastCell = NULL_PTR;
+static uint32 g_Sim_LastValue = 0;
+
+static Sim_ObserverType g_Sim_Observer;
+static Sim_StatisticsType g_Sim_Statistics;
+static uint64 g_Sim_EndTime = SIM_NEVER;
+
+/* Core state */
+static uint32 g_Sim_Primask = 0;
+static uint32 g_Sim_Basepri = 0;
+static uint32 g_Sim_PriorityGroup = 0;
+static boolean g_Sim_Sleeping = FALSE;
+static uint64 g_Sim_CpuFraction = 0;
+static uint32 g_Sim_CycleCounter = 0;
+
+/* Exceptions: IRQ bitmaps, the system exceptions pending flags and the active stack */
+static uint32 g_Sim_Enabled[SIM_IRQ_WORDS];
+static uint32 g_Sim_Pending[SIM_IRQ_WORDS];
+static uint32 g_Sim_Active[SIM_IRQ_WORDS];
+static boolean g_Sim_PendSVPending = FALSE;
+static boolean g_Sim_SysTickPending = FALSE;
+static uint8 g_Sim_ActiveStack[SIM_MAX_NESTING];
+static uint32 g_Sim_ActivePriority[SIM_MAX_NESTING];
+static uint32 g_Sim_ActiveCount = 0;
+
+/* SysTick counter */
+static uint32 g_Sim_SysTickValue = 0;
+static uint64 g_Sim_SysTickFraction = 0;
+static boolean g_Sim_SysTickCountFlag = FALSE;
+
+/* Scheduled inputs, sorted by time */
+static Sim_EventType g_Sim_Events[SIM_MAX_EVENTS];
+static uint32 g_Sim_EventsCount = 0;
+static uint32 g_Sim_EventsHead = 0;
+
+static Sim_GpioType g_Sim_Gpio[SIM_PORTS_COUNT];
+static const uint32 g_Sim_GpioBase[SIM_PORTS_COUNT] = {0x40004000, 0x40005000, 0x40006000, 0x40007000, 0x40024000, 0x40025000};
+static const uint8 g_Sim_GpioIrq[SIM_PORTS_COUNT] = {0, 1, 2, 3, 4, 30};
+
+static uint8 g_Sim_UartRx[SIM_UART_FIFO_SIZE];
+static uint32 g_Sim_UartRxHead = 0;
+static uint32 g_Sim_UartRxCount = 0;
+static uint32 g_Sim_UartOverrun = 0;
+
+static uint32 g_Sim_UdmaEnabled = 0;
+static uint32 g_Sim_UdmaAlternate = 0;
+static uint32 g_Sim_UdmaRequestMask = 0;
+static uint32 g_Sim_UdmaUseBurst = 0;
+static uint32 g_Sim_UdmaPriority = 0;
+static uint32 g_Sim_UdmaSoftwareRequest = 0;
+static uint32 g_Sim_UdmaStatus = 0;
+static uint32 g_Sim_UdmaSoftwareDone = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void Sim_Fatal(const char *a_Message, uint32 a_Value)
+{
+    fprintf(stderr, "sim: %s 0x%08X\n", a_Message, a_Value);
+    abort();
+}
+
+static uint32 *Sim_Cell(uint32 a_Address)
+{
+    /* The AHB aperture of a GPIO port uses the words of its APB aperture, the configuration written
+     * through one is read through the other */
+    if((a_Address - SIM_GPIO_AHB_BASE) < (SIM_PORTS_COUNT * SIM_BLOCK_SIZE))
+    {
+        a_Address = g_Sim_GpioBase[(a_Address - SIM_GPIO_AHB_BASE) / SIM_BLOCK_SIZE] + (a_Address % SIM_BLOCK_SIZE);
+    }
+    if((a_Address - SIM_PERIPHERALS_BASE) < SIM_RANGE_SIZE)
+    {
+        return &g_Sim_Peripherals[(a_Address - SIM_PERIPHERALS_BASE) >> 2];
+    }
+    if((a_Address - SIM_SYSTEM_BASE) < SIM_RANGE_SIZE)
+    {
+        return &g_Sim_System[(a_Address - SIM_SYSTEM_BASE) >> 2];
+    }
+    Sim_Fatal("access outside the modelled registers", a_Address);
+    return NULL_PTR;
+}
+
+static uint32 Sim_Read(uint32 a_Address)
+{
+    return *Sim_Cell(a_Address);
+}
+
+/* Register address of a host pointer given to the uDMA, 0 for the memory */
+static uint32 Sim_RegisterAddress(uintptr_t a_Pointer)
+{
+    if((a_Pointer >= (uintptr_t)g_Sim_Peripherals) && (a_Pointer < (uintptr_t)&g_Sim_Peripherals[SIM_RANGE_SIZE / 4]))
+    {
+        return SIM_PERIPHERALS_BASE + (uint32)(a_Pointer - (uintptr_t)g_Sim_Peripherals);
+    }
+    if((a_Pointer >= (uintptr_t)g_Sim_System) && (a_Pointer < (uintptr_t)&g_Sim_System[SIM_RANGE_SIZE / 4]))
+    {
+        return SIM_SYSTEM_BASE + (uint32)(a_Pointer - (uintptr_t)g_Sim_System);
+    }
+    return 0;
+}
+
+/*------------------------------- Clocks --------------------------------------*/
+
+/* System clock period from RCC2 ... the PLL or the 16 MHz oscillators, Deep-Sleep runs from PIOSC */
+static uint64 Sim_ClockPeriod(void)
+{
+    uint32 Rcc2 = Sim_Read(SIM_SYSCTL_RCC2);
+
+    if((g_Sim_Sleeping == TRUE) && (Sim_Read(SIM_SCB_SCR) & SIM_SCR_SLEEPDEEP))
+    {
+        return SIM_PIOSC_PERIOD;
+    }
+    if((Rcc2 & SIM_RCC2_USERCC2) && !(Rcc2 & SIM_RCC2_BYPASS2))
+    {
+        if(Rcc2 & SIM_RCC2_DIV400)
+        {
+            return SIM_PLL_PERIOD * (((Rcc2 >> SIM_RCC2_SYSDIV2_BITS_POS) & SIM_RCC2_SYSDIV2_MASK) + 1);
+        }
+        return 2 * SIM_PLL_PERIOD * (((Rcc2 >> (SIM_RCC2_SYSDIV2_BITS_POS + 1)) & (SIM_RCC2_SYSDIV2_MASK >> 1)) + 1);
+    }
+    return SIM_PIOSC_PERIOD;
+}
+
+static uint64 Sim_SysTickPeriod(void)
+{
+    return (Sim_Read(SIM_SYSTICK_CTRL) & SIM_STCTRL_CLK_SRC) ? Sim_ClockPeriod() : SIM_PIOSC_4_PERIOD;
+}
+
+/*------------------------------- Exceptions ----------------------------------*/
+
+static boolean Sim_IrqBit(const uint32 *a_Bitmap, uint32 a_Irq)
+{
+    return (a_Bitmap[a_Irq / 32] & (1UL << (a_Irq % 32))) ? TRUE : FALSE;
+}
+
+static void Sim_PendIrq(uint32 a_Irq)
+{
+    g_Sim_Pending[a_Irq / 32] |= (1UL << (a_Irq % 32));
+}
+
+/* A level sensitive line pends its IRQ again after the handler returns */
+static void Sim_AssertLine(uint32 a_Irq)
+{
+    if(Sim_IrqBit(g_Sim_Active, a_Irq) == FALSE)
+    {
+        Sim_PendIrq(a_Irq);
+    }
+}
+
+static uint32 Sim_Priority(uint32 a_Vector)
+{
+    if(a_Vector == SIM_PENDSV_VECTOR)
+    {
+        return (Sim_Read(SIM_SCB_SHPR3) >> 16) & SIM_PRIORITY_MASK;
+    }
+    if(a_Vector == SIM_SYSTICK_VECTOR)
+    {
+        return (Sim_Read(SIM_SCB_SHPR3) >> 24) & SIM_PRIORITY_MASK;
+    }
+    return ((const uint8 *)Sim_Cell(SIM_NVIC_PRI0))[a_Vector - SIM_IRQ_VECTOR(0)] & SIM_PRIORITY_MASK;
+}
+
+/* Part of a priority compared for the preemption, the bits below PRIGROUP + 1 are the subpriority */
+static uint32 Sim_PreemptionPriority(uint32 a_Priority)
+{
+    return a_Priority & ~((2UL << g_Sim_PriorityGroup) - 1);
+}
+
+/* Preemption priority of the active exception, raised by BASEPRI */
+static uint32 Sim_ExecutionPriority(void)
+{
+    uint32 Priority = (g_Sim_ActiveCount == 0) ? SIM_THREAD_PRIORITY : g_Sim_ActivePriority[g_Sim_ActiveCount - 1];
+
+    if((g_Sim_Basepri != 0) && (Sim_PreemptionPriority(g_Sim_Basepri) < Priority))
+    {
+        Priority = Sim_PreemptionPriority(g_Sim_Basepri);
+    }
+    return Priority;
+}
+
+/* Highest priority pending and enabled exception (the lowest number wins a tie), 0 if none */
+static uint32 Sim_HighestPending(void)
+{
+    uint32 Best_Vector = 0;
+    uint32 Best_Priority = SIM_THREAD_PRIORITY;
+    uint32 Word;
+    uint32 Ready;
+    uint32 Irq;
+
+    if(g_Sim_PendSVPending == TRUE)
+    {
+        Best_Vector = SIM_PENDSV_VECTOR;
+        Best_Priority = Sim_Priority(SIM_PENDSV_VECTOR);
+    }
+    if((g_Sim_SysTickPending == TRUE) && ((Best_Vector == 0) || (Sim_Priority(SIM_SYSTICK_VECTOR) < Best_Priority)))
+    {
+        Best_Vector = SIM_SYSTICK_VECTOR;
+        Best_Priority = Sim_Priority(SIM_SYSTICK_VECTOR);
+    }
+    for(Word = 0; Word < SIM_IRQ_WORDS; Word++)
+    {
+        Ready = g_Sim_Pending[Word] & g_Sim_Enabled[Word];
+        while(Ready != 0)
+        {
+            Irq = (Word * 32) + (uint32)__builtin_ctz(Ready);
+            Ready &= Ready - 1;
+            if((Best_Vector == 0) || (Sim_Priority(SIM_IRQ_VECTOR(Irq)) < Best_Priority))
+            {
+                Best_Vector = SIM_IRQ_VECTOR(Irq);
+                Best_Priority = Sim_Priority(Best_Vector);
+            }
+        }
+    }
+    return Best_Vector;
+}
+
+/*------------------------------- SysTick -------------------------------------*/
+
+static void Sim_SysTickWrap(void)
+{
+    g_Sim_SysTickCountFlag = TRUE;
+    if(Sim_Read(SIM_SYSTICK_CTRL) & SIM_STCTRL_INTEN)
+    {
+        g_Sim_SysTickPending = TRUE;
+    }
+}
+
+/* The counter reloads on the count after 0 and requests the interrupt on the count from 1 to 0 */
+static void Sim_SysTickCount(uint64 a_Counts)
+{
+    uint64 Period = (uint64)(Sim_Read(SIM_SYSTICK_RELOAD) & SIM_STRELOAD_MASK) + 1;
+
+    while(a_Counts != 0)
+    {
+        if(g_Sim_SysTickValue == 0)
+        {
+            if(Period == 1)
+            {
+                return;
+            }
+            g_Sim_SysTickValue = (uint32)(Period - 1);
+            a_Counts--;
+            continue;
+        }
+        if(a_Counts < g_Sim_SysTickValue)
+        {
+            g_Sim_SysTickValue -= (uint32)a_Counts;
+            return;
+        }
+        a_Counts -= g_Sim_SysTickValue;
+        g_Sim_SysTickValue = 0;
+        Sim_SysTickWrap();
+
+        /* Whole periods only set the same flags again */
+        if(a_Counts >= Period)
+        {
+            a_Counts %= Period;
+        }
+    }
+}
+
+/* Time to the next SysTick interrupt request */
+static uint64 Sim_SysTickWakeUpTime(void)
+{
+    uint32 Ctrl = Sim_Read(SIM_SYSTICK_CTRL);
+    uint64 Period = (uint64)(Sim_Read(SIM_SYSTICK_RELOAD) & SIM_STRELOAD_MASK) + 1;
+    uint64 Counts;
+
+    if(((Ctrl & (SIM_STCTRL_ENABLE | SIM_STCTRL_INTEN)) != (SIM_STCTRL_ENABLE | SIM_STCTRL_INTEN)) ||
+       ((g_Sim_SysTickValue == 0) && (Period == 1)))
+    {
+        return SIM_NEVER;
+    }
+    Counts = (g_Sim_SysTickValue != 0) ? g_Sim_SysTickValue : Period;
+    return (Counts * Sim_SysTickPeriod()) - g_Sim_SysTickFraction;
+}
+
+/*------------------------------- GPIO ----------------------------------------*/
+
+static uint32 Sim_GpioRegister(Sim_PortType a_Port, uint32 a_Offset)
+{
+    return Sim_Read(g_Sim_GpioBase[a_Port] + a_Offset);
+}
+
+static uint8 Sim_GpioLevels(Sim_PortType a_Port)
+{
+    uint8 Direction = (uint8)Sim_GpioRegister(a_Port, SIM_GPIO_DIR);
+
+    return (uint8)((Direction & g_Sim_Gpio[a_Port].Output) | (~Direction & g_Sim_Gpio[a_Port].Input));
+}
+
+static uint8 Sim_GpioRawStatus(Sim_PortType a_Port)
+{
+    uint8 Level_Sense = (uint8)Sim_GpioRegister(a_Port, SIM_GPIO_IS);
+    uint8 Level_Status = (uint8)~(Sim_GpioLevels(a_Port) ^ (uint8)Sim_GpioRegister(a_Port, SIM_GPIO_IEV));
+
+    return (uint8)((g_Sim_Gpio[a_Port].EdgeStatus & ~Level_Sense) | (Level_Status & Level_Sense));
+}
+
+static void Sim_GpioObserve(Sim_PortType a_Port)
+{
+    uint8 Outputs = (uint8)(Sim_GpioRegister(a_Port, SIM_GPIO_DIR) & g_Sim_Gpio[a_Port].Output);
+
+    if(Outputs != g_Sim_Gpio[a_Port].Observed)
+    {
+        g_Sim_Gpio[a_Port].Observed = Outputs;
+        if(g_Sim_Observer.GpioOutput != NULL_PTR)
+        {
+            g_Sim_Observer.GpioOutput(g_Sim_Statistics.Time, a_Port, Outputs);
+        }
+    }
+}
+
+static void Sim_GpioDrive(Sim_PortType a_Port, uint8 a_Pin, uint8 a_Level)
+{
+    uint8 Mask = (uint8)(1 << a_Pin);
+    uint8 Before = Sim_GpioLevels(a_Port);
+    uint8 After;
+    uint8 Edges;
+
+    g_Sim_Gpio[a_Port].Input = (a_Level != 0) ? (g_Sim_Gpio[a_Port].Input | Mask) : (g_Sim_Gpio[a_Port].Input & ~Mask);
+    After = Sim_GpioLevels(a_Port);
+
+    /* Both edges, or the edge selected by IEV (1 for rising) */
+    Edges = (uint8)((Before ^ After) & ~Sim_GpioRegister(a_Port, SIM_GPIO_IS));
+    Edges &= (uint8)(Sim_GpioRegister(a_Port, SIM_GPIO_IBE) | ~(After ^ Sim_GpioRegister(a_Port, SIM_GPIO_IEV)));
+    g_Sim_Gpio[a_Port].EdgeStatus |= Edges;
+}
+
+/* Port and offset of a GPIO register in one of the apertures, SIM_PORTS_COUNT otherwise */
+static Sim_PortType Sim_GpioDecode(uint32 a_Address, uint32 *a_Offset)
+{
+    Sim_PortType Port;
+
+    for(Port = SIM_PORT_A; Port < SIM_PORTS_COUNT; Port++)
+    {
+        if((a_Address - g_Sim_GpioBase[Port]) < SIM_BLOCK_SIZE)
+        {
+            *a_Offset = a_Address - g_Sim_GpioBase[Port];
+            return Port;
+        }
+        if((a_Address - (SIM_GPIO_AHB_BASE + (Port * SIM_BLOCK_SIZE))) < SIM_BLOCK_SIZE)
+        {
+            *a_Offset = a_Address - (SIM_GPIO_AHB_BASE + (Port * SIM_BLOCK_SIZE));
+            return Port;
+        }
+    }
+    return SIM_PORTS_COUNT;
+}
+
+static void Sim_GpioRefresh(Sim_PortType a_Port, uint32 a_Offset, uint32 *a_Cell)
+{
+    if(a_Offset <= SIM_GPIO_DATA_LAST)
+    {
+        /* Address bits 9:2 mask the pins */
+        *a_Cell = Sim_GpioLevels(a_Port) & (a_Offset >> 2);
+    }
+    else if(a_Offset == SIM_GPIO_RIS)
+    {
+        *a_Cell = Sim_GpioRawStatus(a_Port);
+    }
+    else if(a_Offset == SIM_GPIO_MIS)
+    {
+        *a_Cell = Sim_GpioRawStatus(a_Port) & Sim_GpioRegister(a_Port, SIM_GPIO_IM);
+    }
+    else if(a_Offset == SIM_GPIO_ICR)
+    {
+        *a_Cell = 0;
+    }
+    else
+    {
+        /* Configuration registers keep the written value in their host word */
+    }
+}
+
+static void Sim_GpioWrite(Sim_PortType a_Port, uint32 a_Offset, uint32 a_Value)
+{
+    uint8 Mask;
+
+    if(a_Offset <= SIM_GPIO_DATA_LAST)
+    {
+        Mask = (uint8)(a_Offset >> 2);
+        g_Sim_Gpio[a_Port].Output = (uint8)((g_Sim_Gpio[a_Port].Output & ~Mask) | (a_Value & Mask));
+    }
+    else if(a_Offset == SIM_GPIO_ICR)
+    {
+        g_Sim_Gpio[a_Port].EdgeStatus &= (uint8)~a_Value;
+    }
+    else
+    {
+    }
+    Sim_GpioObserve(a_Port);
+}
+
+/*------------------------------- UART0 ---------------------------------------*/
+
+static uint32 Sim_UartRegister(uint32 a_Offset)
+{
+    return Sim_Read(SIM_UART0_BASE + a_Offset);
+}
+
+static void Sim_UartTransmit(uint8 a_Byte)
+{
+    g_Sim_Statistics.Uart0Bytes++;
+    if(g_Sim_Observer.Uart0Transmit != NULL_PTR)
+    {
+        g_Sim_Observer.Uart0Transmit(g_Sim_Statistics.Time, a_Byte);
+    }
+}
+
+static void Sim_UartReceive(uint8 a_Byte)
+{
+    if(g_Sim_UartRxCount == SIM_UART_FIFO_SIZE)
+    {
+        g_Sim_UartOverrun = SIM_UART_INT_OE;
+        return;
+    }
+    g_Sim_UartRx[(g_Sim_UartRxHead + g_Sim_UartRxCount) % SIM_UART_FIFO_SIZE] = a_Byte;
+    g_Sim_UartRxCount++;
+}
+
+/* RX when the FIFO reaches the IFLS level, RT while bytes are waiting below it */
+static uint32 Sim_UartRawStatus(void)
+{
+    static const uint32 Levels[] = {2, 4, 8, 12, 14, 14, 14, 14};
+    uint32 Level = Levels[(Sim_UartRegister(SIM_UART_IFLS) >> 3) & 0x7];
+    uint32 Status = g_Sim_UartOverrun;
+
+    if(g_Sim_UartRxCount >= Level)
+    {
+        Status |= SIM_UART_INT_RX;
+    }
+    else if(g_Sim_UartRxCount != 0)
+    {
+        Status |= SIM_UART_INT_RT;
+    }
+    else
+    {
+    }
+    return Status;
+}
+
+static void Sim_UartRefresh(uint32 a_Offset, uint32 *a_Cell)
+{
+    switch(a_Offset)
+    {
+    case SIM_UART_DR:
+        *a_Cell = SIM_UART_DR_READ_MARK | ((g_Sim_UartRxCount != 0) ? g_Sim_UartRx[g_Sim_UartRxHead] : 0);
+        break;
+    case SIM_UART_FR:
+        /* The transmitter is never full, the bytes leave at once */
+        *a_Cell = SIM_UART_FR_TXFE | ((g_Sim_UartRxCount == 0) ? SIM_UART_FR_RXFE : 0);
+        break;
+    case SIM_UART_RIS:
+        *a_Cell = Sim_UartRawStatus();
+        break;
+    case SIM_UART_MIS:
+        *a_Cell = Sim_UartRawStatus() & Sim_UartRegister(SIM_UART_IM);
+        break;
+    case SIM_UART_ICR:
+        *a_Cell = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+static void Sim_UartComplete(uint32 a_Offset, boolean a_Written, uint32 a_Value)
+{
+    if(a_Offset == SIM_UART_DR)
+    {
+        if(a_Written == TRUE)
+        {
+            Sim_UartTransmit((uint8)a_Value);
+        }
+        else if(g_Sim_UartRxCount != 0)
+        {
+            g_Sim_UartRxHead = (g_Sim_UartRxHead + 1) % SIM_UART_FIFO_SIZE;
+            g_Sim_UartRxCount--;
+        }
+        else
+        {
+        }
+    }
+    else if((a_Offset == SIM_UART_ICR) && (a_Written == TRUE))
+    {
+        g_Sim_UartOverrun &= ~a_Value;
+    }
+    else
+    {
+    }
+}
+
+/*------------------------------- uDMA ----------------------------------------*/
+
+/* Set/clear register pairs of the controller */
+static uint32 *Sim_UdmaPair(uint32 a_Offset)
+{
+    switch(a_Offset & ~0x4UL)
+    {
+    case SIM_UDMA_USEBURSTSET:
+        return &g_Sim_UdmaUseBurst;
+    case SIM_UDMA_REQMASKSET:
+        return &g_Sim_UdmaRequestMask;
+    case SIM_UDMA_ENASET:
+        return &g_Sim_UdmaEnabled;
+    case SIM_UDMA_ALTSET:
+        return &g_Sim_UdmaAlternate;
+    case SIM_UDMA_PRIOSET:
+        return &g_Sim_UdmaPriority;
+    default:
+        return NULL_PTR;
+    }
+}
+
+static void Sim_UdmaRefresh(uint32 a_Offset, uint32 *a_Cell)
+{
+    uint32 *Pair = Sim_UdmaPair(a_Offset);
+
+    if(Pair != NULL_PTR)
+    {
+        /* The clear registers read as 0 so writing back the read bits is seen */
+        *a_Cell = (a_Offset & 0x4) ? 0 : *Pair;
+    }
+    else if(a_Offset == SIM_UDMA_CHIS)
+    {
+        *a_Cell = g_Sim_UdmaStatus;
+    }
+    else if(a_Offset == SIM_UDMA_SWREQ)
+    {
+        *a_Cell = 0;
+    }
+    else
+    {
+    }
+}
+
+static void Sim_UdmaComplete(uint32 a_Offset, boolean a_Written, uint32 a_Value)
+{
+    uint32 *Pair = Sim_UdmaPair(a_Offset);
+
+    /* CHIS is cleared by writing the bits it reads, an access leaving a non-zero value is a write */
+    if((a_Offset == SIM_UDMA_CHIS) && (a_Value != 0))
+    {
+        a_Written = TRUE;
+    }
+    if(a_Written == FALSE)
+    {
+        return;
+    }
+
+    if(Pair != NULL_PTR)
+    {
+        *Pair = (a_Offset & 0x4) ? (*Pair & ~a_Value) : (*Pair | a_Value);
+    }
+    else if(a_Offset == SIM_UDMA_CHIS)
+    {
+        g_Sim_UdmaStatus &= ~a_Value;
+        g_Sim_UdmaSoftwareDone &= ~a_Value;
+    }
+    else if(a_Offset == SIM_UDMA_SWREQ)
+    {
+        g_Sim_UdmaSoftwareRequest |= a_Value;
+    }
+    else
+    {
+    }
+}
+
+static uint32 Sim_UdmaLoad(uint32 a_Address, uint32 a_Size)
+{
+    uint32 Register = Sim_RegisterAddress((uintptr_t)a_Address);
+    const uint8 *Memory = (const uint8 *)(uintptr_t)a_Address;
+    uint32 Value = 0;
+
+    if(Register == (SIM_UART0_BASE + SIM_UART_DR))
+    {
+        Sim_UartRefresh(SIM_UART_DR, &Value);
+        Sim_UartComplete(SIM_UART_DR, FALSE, Value);
+        return Value & ~SIM_UART_DR_READ_MARK;
+    }
+    if(Register != 0)
+    {
+        return Sim_Read(Register);
+    }
+    memcpy(&Value, Memory, a_Size);
+    return Value;
+}
+
+static void Sim_UdmaStore(uint32 a_Address, uint32 a_Size, uint32 a_Value)
+{
+    uint32 Register = Sim_RegisterAddress((uintptr_t)a_Address);
+
+    if(Register == (SIM_UART0_BASE + SIM_UART_DR))
+    {
+        Sim_UartTransmit((uint8)a_Value);
+    }
+    else if(Register != 0)
+    {
+        *Sim_Cell(Register) = a_Value;
+    }
+    else
+    {
+        memcpy((uint8 *)(uintptr_t)a_Address, &a_Value, a_Size);
+    }
+}
+
+/* Execute a basic or auto structure to its end, the structure is left in the stop mode */
+static void Sim_UdmaRun(Sim_UdmaControlType *a_Structure)
+{
+    uint32 Control = a_Structure->Control;
+    uint32 Count = ((Control >> SIM_UDMA_XFERSIZE_BITS_POS) & SIM_UDMA_XFERSIZE_MASK) + 1;
+    uint32 Size = 1UL << ((Control >> SIM_UDMA_SRCSIZE_BITS_POS) & 0x3);
+    uint32 Source_Increment = (Control >> SIM_UDMA_SRCINC_BITS_POS) & 0x3;
+    uint32 Destination_Increment = (Control >> SIM_UDMA_DSTINC_BITS_POS) & 0x3;
+    uint32 Source_Step = (Source_Increment == SIM_UDMA_INC_NONE) ? 0 : (1UL << Source_Increment);
+    uint32 Destination_Step = (Destination_Increment == SIM_UDMA_INC_NONE) ? 0 : (1UL << Destination_Increment);
+    uint32 Source = a_Structure->SourceEnd - ((Count - 1) * Source_Step);
+    uint32 Destination = a_Structure->DestinationEnd - ((Count - 1) * Destination_Step);
+    uint32 Index;
+
+    for(Index = 0; Index < Count; Index++)
+    {
+        Sim_UdmaStore(Destination, Size, Sim_UdmaLoad(Source, Size));
+        Source += Source_Step;
+        Destination += Destination_Step;
+    }
+    a_Structure->Control = Control & ~((SIM_UDMA_XFERSIZE_MASK << SIM_UDMA_XFERSIZE_BITS_POS) | SIM_UDMA_MODE_MASK);
+}
+
+/* Scatter-gather ... the primary copies each task of the list to the alternate, which is executed at once */
+static void Sim_UdmaRunTasks(Sim_UdmaControlType *a_Primary, Sim_UdmaControlType *a_Alternate)
+{
+    uint32 Tasks = (((a_Primary->Control >> SIM_UDMA_XFERSIZE_BITS_POS) & SIM_UDMA_XFERSIZE_MASK) + 1) / 4;
+    uint32 List = a_Primary->SourceEnd + 4 - (Tasks * sizeof(Sim_UdmaControlType));
+    uint32 Task;
+
+    for(Task = 0; Task < Tasks; Task++)
+    {
+        memcpy(a_Alternate, (const void *)(uintptr_t)(List + (Task * sizeof(Sim_UdmaControlType))), sizeof(Sim_UdmaControlType));
+        Sim_UdmaRun(a_Alternate);
+    }
+    a_Primary->Control &= ~((SIM_UDMA_XFERSIZE_MASK << SIM_UDMA_XFERSIZE_BITS_POS) | SIM_UDMA_MODE_MASK);
+}
+
+/* Service one request of a channel ... the transfers are instantaneous */
+static void Sim_UdmaServiceChannel(uint32 a_Channel, boolean a_Software)
+{
+    Sim_UdmaControlType *Table = (Sim_UdmaControlType *)(uintptr_t)Sim_Read(SIM_UDMA_BASE + SIM_UDMA_CTLBASE);
+    uint32 Mask = 1UL << a_Channel;
+    Sim_UdmaControlType *Primary = &Table[a_Channel];
+    Sim_UdmaControlType *Alternate = &Table[a_Channel + SIM_UDMA_CHANNELS];
+    Sim_UdmaControlType *Structure = (g_Sim_UdmaAlternate & Mask) ? Alternate : Primary;
+    uint32 Mode = Structure->Control & SIM_UDMA_MODE_MASK;
+
+    switch(Mode)
+    {
+    case SIM_UDMA_MODE_BASIC:
+    case SIM_UDMA_MODE_AUTO:
+        Sim_UdmaRun(Structure);
+        g_Sim_UdmaEnabled &= ~Mask;
+        break;
+    case SIM_UDMA_MODE_PING_PONG:
+        /* Continue on the other structure, the channel stops when it is not ready */
+        Sim_UdmaRun(Structure);
+        g_Sim_UdmaAlternate ^= Mask;
+        Structure = (g_Sim_UdmaAlternate & Mask) ? Alternate : Primary;
+        if((Structure->Control & SIM_UDMA_MODE_MASK) == SIM_UDMA_MODE_STOP)
+        {
+            g_Sim_UdmaEnabled &= ~Mask;
+        }
+        break;
+    case SIM_UDMA_MODE_MEMORY_SG:
+    case SIM_UDMA_MODE_PERIPHERAL_SG:
+        Sim_UdmaRunTasks(Primary, Alternate);
+        g_Sim_UdmaEnabled &= ~Mask;
+        break;
+    default:
+        /* Stop mode or a structure that is not ready ... the uDMA error is not modelled */
+        g_Sim_UdmaEnabled &= ~Mask;
+        break;
+    }
+
+    g_Sim_UdmaStatus |= Mask;
+    if(a_Software == TRUE)
+    {
+        g_Sim_UdmaSoftwareDone |= Mask;
+    }
+}
+
+static void Sim_UdmaService(void)
+{
+    uint32 Requests;
+    uint32 Channel;
+
+    /* Software requests, then the UART0 transmitter which always has room in its FIFO */
+    Requests = g_Sim_UdmaSoftwareRequest & g_Sim_UdmaEnabled;
+    g_Sim_UdmaSoftwareRequest = 0;
+    while(Requests != 0)
+    {
+        Channel = (uint32)__builtin_ctz(Requests);
+        Requests &= Requests - 1;
+        Sim_UdmaServiceChannel(Channel, TRUE);
+    }
+
+    if((g_Sim_UdmaEnabled & ~g_Sim_UdmaRequestMask & (1UL << SIM_UDMA_UART0_TX_CHANNEL)) &&
+       (Sim_UartRegister(SIM_UART_DMACTL) & SIM_UART_DMACTL_TXDMAE) &&
+       ((Sim_UartRegister(SIM_UART_CTL) & SIM_UART_CTL_ENABLED) == SIM_UART_CTL_ENABLED))
+    {
+        Sim_UdmaServiceChannel(SIM_UDMA_UART0_TX_CHANNEL, FALSE);
+    }
+}
+
+/*------------------------------- System Control Space ------------------------*/
+
+static void Sim_SystemRefresh(uint32 a_Address, uint32 *a_Cell)
+{
+    uint32 Word = (a_Address >> 2) & 0x7;
+
+    if(a_Address == SIM_SYSTICK_CTRL)
+    {
+        *a_Cell = (*a_Cell & ~SIM_STCTRL_COUNT) | ((g_Sim_SysTickCountFlag == TRUE) ? SIM_STCTRL_COUNT : 0);
+    }
+    else if(a_Address == SIM_SYSTICK_CURRENT)
+    {
+        *a_Cell = g_Sim_SysTickValue;
+    }
+    else if(a_Address == SIM_SCB_ICSR)
+    {
+        *a_Cell = ((g_Sim_ActiveCount != 0) ? g_Sim_ActiveStack[g_Sim_ActiveCount - 1] : 0) |
+                  ((g_Sim_PendSVPending == TRUE) ? SIM_ICSR_PENDSVSET : 0) |
+                  ((g_Sim_SysTickPending == TRUE) ? SIM_ICSR_PENDSTSET : 0);
+    }
+    else if(a_Address == SIM_SCB_APINT)
+    {
+        *a_Cell = SIM_APINT_VECTKEYSTAT | (g_Sim_PriorityGroup << SIM_APINT_PRIGROUP_BITS_POS);
+    }
+    else if(a_Address == SIM_DWT_CYCCNT)
+    {
+        *a_Cell = g_Sim_CycleCounter;
+    }
+    else if((a_Address - SIM_NVIC_EN0) < (4 * SIM_IRQ_WORDS))
+    {
+        *a_Cell = g_Sim_Enabled[Word];
+    }
+    else if((a_Address - SIM_NVIC_PEND0) < (4 * SIM_IRQ_WORDS))
+    {
+        *a_Cell = g_Sim_Pending[Word];
+    }
+    else if(((a_Address - SIM_NVIC_DIS0) < (4 * SIM_IRQ_WORDS)) || ((a_Address - SIM_NVIC_UNPEND0) < (4 * SIM_IRQ_WORDS)))
+    {
+        /* Read as 0 so writing back the read bits is seen */
+        *a_Cell = 0;
+    }
+    else if((a_Address - SIM_NVIC_ACTIVE0) < (4 * SIM_IRQ_WORDS))
+    {
+        *a_Cell = g_Sim_Active[Word];
+    }
+    else if(a_Address == SIM_NVIC_SWTRIG)
+    {
+        /* Write-only, any IRQ number differs from the read value */
+        *a_Cell = 0xFFFFFFFF;
+    }
+    else
+    {
+    }
+}
+
+static void Sim_SystemComplete(uint32 a_Address, boolean a_Written, uint32 a_Value)
+{
+    uint32 Word = (a_Address >> 2) & 0x7;
+
+    if(a_Address == SIM_SYSTICK_CTRL)
+    {
+        /* COUNTFLAG is cleared by a read */
+        g_Sim_SysTickCountFlag = FALSE;
+        return;
+    }
+    if(a_Written == FALSE)
+    {
+        return;
+    }
+
+    if(a_Address == SIM_SYSTICK_CURRENT)
+    {
+        g_Sim_SysTickValue = 0;
+        g_Sim_SysTickCountFlag = FALSE;
+    }
+    else if(a_Address == SIM_SYSTICK_RELOAD)
+    {
+        *Sim_Cell(a_Address) = a_Value & SIM_STRELOAD_MASK;
+    }
+    else if(a_Address == SIM_SCB_ICSR)
+    {
+        g_Sim_PendSVPending = (a_Value & SIM_ICSR_PENDSVSET) ? TRUE : ((a_Value & SIM_ICSR_PENDSVCLR) ? FALSE : g_Sim_PendSVPending);
+        g_Sim_SysTickPending = (a_Value & SIM_ICSR_PENDSTSET) ? TRUE : ((a_Value & SIM_ICSR_PENDSTCLR) ? FALSE : g_Sim_SysTickPending);
+    }
+    else if(a_Address == SIM_SCB_APINT)
+    {
+        /* Ignored without the key, the reset requests are not modelled */
+        if((a_Value >> 16) == SIM_APINT_VECTKEY)
+        {
+            g_Sim_PriorityGroup = (a_Value >> SIM_APINT_PRIGROUP_BITS_POS) & 0x7;
+        }
+    }
+    else if(a_Address == SIM_DWT_CYCCNT)
+    {
+        g_Sim_CycleCounter = a_Value;
+    }
+    else if((a_Address - SIM_NVIC_EN0) < (4 * SIM_IRQ_WORDS))
+    {
+        g_Sim_Enabled[Word] |= a_Value;
+    }
+    else if((a_Address - SIM_NVIC_DIS0) < (4 * SIM_IRQ_WORDS))
+    {
+        g_Sim_Enabled[Word] &= ~a_Value;
+    }
+    else if((a_Address - SIM_NVIC_PEND0) < (4 * SIM_IRQ_WORDS))
+    {
+        g_Sim_Pending[Word] |= a_Value;
+    }
+    else if((a_Address - SIM_NVIC_UNPEND0) < (4 * SIM_IRQ_WORDS))
+    {
+        g_Sim_Pending[Word] &= ~a_Value;
+    }
+    else if(a_Address == SIM_NVIC_SWTRIG)
+    {
+        Sim_PendIrq(a_Value & 0xFF);
+    }
+    else
+    {
+    }
+}
+
+/*------------------------------- Accesses ------------------------------------*/
+
+/* Value seen by the firmware for the register it is accessing */
+static void Sim_Refresh(uint32 a_Address, uint32 *a_Cell)
+{
+    Sim_PortType Port;
+    uint32 Offset;
+
+    if(a_Address >= SIM_SYSTEM_BASE)
+    {
+        Sim_SystemRefresh(a_Address, a_Cell);
+    }
+    else if(a_Address == SIM_SYSCTL_RIS)
+    {
+        *a_Cell |= SIM_SYSCTL_READY_FLAGS;
+    }
+    else if(a_Address == SIM_SYSCTL_PLLSTAT)
+    {
+        *a_Cell = 1;
+    }
+    else if((a_Address >= SIM_SYSCTL_PR_FIRST) && (a_Address <= SIM_SYSCTL_PR_LAST))
+    {
+        /* The peripherals are ready as soon as their clock is enabled */
+        *a_Cell = Sim_Read(SIM_SYSCTL_RCGC_FIRST + (a_Address - SIM_SYSCTL_PR_FIRST));
+    }
+    else if((a_Address - SIM_UART0_BASE) < SIM_BLOCK_SIZE)
+    {
+        Sim_UartRefresh(a_Address - SIM_UART0_BASE, a_Cell);
+    }
+    else if((a_Address - SIM_UDMA_BASE) < SIM_BLOCK_SIZE)
+    {
+        Sim_UdmaRefresh(a_Address - SIM_UDMA_BASE, a_Cell);
+    }
+    else if((Port = Sim_GpioDecode(a_Address, &Offset)) != SIM_PORTS_COUNT)
+    {
+        Sim_GpioRefresh(Port, Offset, a_Cell);
+    }
+    else
+    {
+    }
+}
+
+/* Side effects of the previous access, it was a write if its host word changed ... a write of the value
+ * just read is not seen, so the write-only and clear registers read a value that no write repeats */
+static void Sim_CompleteAccess(void)
+{
+    uint32 *Cell = g_Sim_LastCell;
+    uint32 Address = g_Sim_LastAddress;
+    boolean Written;
+    Sim_PortType Port;
+    uint32 Offset;
+
+    if(Cell == NULL_PTR)
+    {
+        return;
+    }
+    g_Sim_LastCell = NULL_PTR;
+    Written = (*Cell != g_Sim_LastValue) ? TRUE : FALSE;
+
+    if(Address >= SIM_SYSTEM_BASE)
+    {
+        Sim_SystemComplete(Address, Written, *Cell);
+    }
+    else if((Address - SIM_UART0_BASE) < SIM_BLOCK_SIZE)
+    {
+        Sim_UartComplete(Address - SIM_UART0_BASE, Written, *Cell);
+    }
+    else if((Address - SIM_UDMA_BASE) < SIM_BLOCK_SIZE)
+    {
+        Sim_UdmaComplete(Address - SIM_UDMA_BASE, Written, *Cell);
+    }
+    else if(Written == FALSE)
+    {
+    }
+    else if((Port = Sim_GpioDecode(Address, &Offset)) != SIM_PORTS_COUNT)
+    {
+        Sim_GpioWrite(Port, Offset, *Cell);
+    }
+    else
+    {
+    }
+}
+
+/*------------------------------- Time ----------------------------------------*/
+
+static void Sim_ProcessEvents(void)
+{
+    Sim_EventType *Event;
+
+    while((g_Sim_EventsHead < g_Sim_EventsCount) && (g_Sim_Events[g_Sim_EventsHead].Time <= g_Sim_Statistics.Time))
+    {
+        Event = &g_Sim_Events[g_Sim_EventsHead++];
+        if(Event->Kind == SIM_EVENT_GPIO_LEVEL)
+        {
+            Sim_GpioDrive(Event->Port, Event->Pin, Event->Value);
+        }
+        else
+        {
+            Sim_UartReceive(Event->Value);
+        }
+    }
+}
+
+/* Let a_Time picoseconds elapse, split at the scheduled events */
+static void Sim_Elapse(uint64 a_Time)
+{
+    uint64 Step;
+    uint64 Period;
+    uint64 Cycles;
+
+    while(a_Time != 0)
+    {
+        Step = a_Time;
+        if((g_Sim_EventsHead < g_Sim_EventsCount) && ((g_Sim_Events[g_Sim_EventsHead].Time - g_Sim_Statistics.Time) < Step))
+        {
+            Step = g_Sim_Events[g_Sim_EventsHead].Time - g_Sim_Statistics.Time;
+        }
+        if((g_Sim_EndTime - g_Sim_Statistics.Time) < Step)
+        {
+            Step = g_Sim_EndTime - g_Sim_Statistics.Time;
+        }
+
+        /* The cycle counter stops with the core clock */
+        if(g_Sim_Sleeping == FALSE)
+        {
+            Period = Sim_ClockPeriod();
+            g_Sim_CpuFraction += Step;
+            Cycles = g_Sim_CpuFraction / Period;
+            g_Sim_CpuFraction %= Period;
+            if((Sim_Read(SIM_DWT_CTRL) & SIM_DWT_CYCCNTENA) && (Sim_Read(SIM_DEBUG_DEMCR) & SIM_DEMCR_TRCENA))
+            {
+                g_Sim_CycleCounter += (uint32)Cycles;
+            }
+        }
+        else
+        {
+            g_Sim_Statistics.SleepTime += Step;
+        }
+
+        if(Sim_Read(SIM_SYSTICK_CTRL) & SIM_STCTRL_ENABLE)
+        {
+            Period = Sim_SysTickPeriod();
+            g_Sim_SysTickFraction += Step;
+            Cycles = g_Sim_SysTickFraction / Period;
+            g_Sim_SysTickFraction %= Period;
+            Sim_SysTickCount(Cycles);
+        }
+
+        g_Sim_Statistics.Time += Step;
+        a_Time -= Step;
+        Sim_ProcessEvents();
+
+        if(g_Sim_Statistics.Time >= g_Sim_EndTime)
+        {
+            Sim_Finish("end time reached");
+        }
+    }
+}
+
+/*------------------------------- Interrupts ----------------------------------*/
+
+/* Pend the IRQs of the asserted peripheral lines */
+static void Sim_UpdateLines(void)
+{
+    Sim_PortType Port;
+
+    for(Port = SIM_PORT_A; Port < SIM_PORTS_COUNT; Port++)
+    {
+        if(Sim_GpioRawStatus(Port) & Sim_GpioRegister(Port, SIM_GPIO_IM))
+        {
+            Sim_AssertLine(g_Sim_GpioIrq[Port]);
+        }
+    }
+
+    /* A peripheral channel signals its completion on the interrupt of the peripheral */
+    if((Sim_UartRawStatus() & Sim_UartRegister(SIM_UART_IM)) ||
+       (g_Sim_UdmaStatus & ~g_Sim_UdmaSoftwareDone & SIM_UDMA_UART0_CHANNELS))
+    {
+        Sim_AssertLine(SIM_UART0_IRQ);
+    }
+    if(g_Sim_UdmaStatus & g_Sim_UdmaSoftwareDone)
+    {
+        Sim_AssertLine(SIM_UDMA_SOFTWARE_IRQ);
+    }
+}
+
+static void Sim_ExitException(void)
+{
+    uint32 Vector = g_Sim_ActiveStack[--g_Sim_ActiveCount];
+
+    if(Vector >= SIM_IRQ_VECTOR(0))
+    {
+        g_Sim_Active[(Vector - SIM_IRQ_VECTOR(0)) / 32] &= ~(1UL << ((Vector - SIM_IRQ_VECTOR(0)) % 32));
+    }
+}
+
+static void Sim_RunException(uint32 a_Vector)
+{
+    uint32 Irq = a_Vector - SIM_IRQ_VECTOR(0);
+    Sim_HandlerType Handler;
+
+    if(a_Vector == SIM_PENDSV_VECTOR)
+    {
+        g_Sim_PendSVPending = FALSE;
+    }
+    else if(a_Vector == SIM_SYSTICK_VECTOR)
+    {
+        g_Sim_SysTickPending = FALSE;
+    }
+    else
+    {
+        g_Sim_Pending[Irq / 32] &= ~(1UL << (Irq % 32));
+        g_Sim_Active[Irq / 32] |= (1UL << (Irq % 32));
+    }
+    /* The handler is fetched from the table pointed by VTOR, the firmware can relocate it */
+    Handler = ((const Sim_HandlerType *)(uintptr_t)Sim_Read(SIM_SCB_VTOR))[a_Vector];
+    if(Handler == NULL_PTR)
+    {
+        Sim_Fatal("no handler for the exception", a_Vector);
+    }
+
+    g_Sim_ActivePriority[g_Sim_ActiveCount] = Sim_PreemptionPriority(Sim_Priority(a_Vector));
+    g_Sim_ActiveStack[g_Sim_ActiveCount++] = (uint8)a_Vector;
+    g_Sim_Statistics.Exceptions[a_Vector]++;
+
+    Sim_Elapse(SIM_EXCEPTION_ENTRY_CYCLES * Sim_ClockPeriod());
+    Handler();
+    Sim_CompleteAccess();
+
+    Sim_ExitException();
+}
+
+/* Take the pending exceptions that preempt the running code */
+static void Sim_Dispatch(void)
+{
+    uint32 Vector;
+
+    Sim_UdmaService();
+    while(g_Sim_Primask == 0)
+    {
+        Sim_UpdateLines();
+        Vector = Sim_HighestPending();
+        if((Vector == 0) || (Sim_PreemptionPriority(Sim_Priority(Vector)) >= Sim_ExecutionPriority()))
+        {
+            break;
+        }
+        Sim_RunException(Vector);
+        Sim_UdmaService();
+    }
+}
+
+/* Common part of the core instructions and the register accesses */
+static void Sim_Step(void)
+{
+    Sim_CompleteAccess();
+    Sim_Elapse(SIM_CYCLES_PER_ACCESS * Sim_ClockPeriod());
+    Sim_Dispatch();
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Sim_Register
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Address - Address of the register
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: volatile uint32 * - Host word of the register
+ * Description: Function behind HW_REGISTER in the host build. The write to the previous register
+ *              is applied, the time of the access elapses and the pending interrupts are taken,
+ *              then the value of the register is refreshed for the caller.
+ ************************************************************************************/
+volatile uint32 *Sim_Register(uint32 a_Address)
+{
+    uint32 *Cell = Sim_Cell(a_Address);
+
+    Sim_Step();
+    Sim_Refresh(a_Address, Cell);
+
+    g_Sim_LastAddress = a_Address;
+    g_Sim_LastCell = Cell;
+    g_Sim_LastValue = *Cell;
+    g_Sim_Statistics.Accesses++;
+
+    return Cell;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_SetPrimask
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Primask - 1 to mask the exceptions, 0 to take the pending ones
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind CPSID I / CPSIE I and MSR PRIMASK in the host build.
+ ************************************************************************************/
+void Sim_SetPrimask(uint32 a_Primask)
+{
+    Sim_CompleteAccess();
+    g_Sim_Primask = a_Primask & 0x1;
+    Sim_Dispatch();
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_GetPrimask
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Current PRIMASK
+ * Description: Function behind MRS PRIMASK in the host build.
+ ************************************************************************************/
+uint32 Sim_GetPrimask(void)
+{
+    return g_Sim_Primask;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_SetBasepri
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Basepri - Masking level, 0 to mask nothing
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind MSR BASEPRI in the host build.
+ ************************************************************************************/
+void Sim_SetBasepri(uint32 a_Basepri)
+{
+    Sim_CompleteAccess();
+    g_Sim_Basepri = a_Basepri & SIM_PRIORITY_MASK;
+    Sim_Dispatch();
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_SetBasepriMax
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Basepri - Masking level, ignored if it does not raise the current one
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind MSR BASEPRI_MAX in the host build.
+ ************************************************************************************/
+void Sim_SetBasepriMax(uint32 a_Basepri)
+{
+    a_Basepri &= SIM_PRIORITY_MASK;
+    if((a_Basepri != 0) && ((g_Sim_Basepri == 0) || (a_Basepri < g_Sim_Basepri)))
+    {
+        Sim_SetBasepri(a_Basepri);
+    }
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_GetBasepri
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Current BASEPRI
+ * Description: Function behind MRS BASEPRI in the host build.
+ ************************************************************************************/
+uint32 Sim_GetBasepri(void)
+{
+    return g_Sim_Basepri;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_SetFaultmask
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Faultmask - FAULTMASK value
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind CPSID F / CPSIE F, the faults are not modelled.
+ ************************************************************************************/
+void Sim_SetFaultmask(uint32 a_Faultmask)
+{
+    (void)a_Faultmask;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_WaitForInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind WFI in the host build. The virtual time jumps to the next SysTick
+ *              wrap or scheduled input until an interrupt is pending, even a masked one. The run
+ *              ends if nothing can wake up the processor.
+ ************************************************************************************/
+void Sim_WaitForInterrupt(void)
+{
+    uint64 Wake_Up;
+    uint32 Vector;
+
+    Sim_CompleteAccess();
+    Sim_UdmaService();
+    g_Sim_Sleeping = TRUE;
+
+    while(1)
+    {
+        Sim_UpdateLines();
+        Vector = Sim_HighestPending();
+        if((Vector != 0) && (Sim_PreemptionPriority(Sim_Priority(Vector)) < Sim_ExecutionPriority()))
+        {
+            break;
+        }
+
+        /* Nothing happens before the next SysTick request or the next input */
+        Wake_Up = Sim_SysTickWakeUpTime();
+        if((g_Sim_EventsHead < g_Sim_EventsCount) && ((g_Sim_Events[g_Sim_EventsHead].Time - g_Sim_Statistics.Time) < Wake_Up))
+        {
+            Wake_Up = g_Sim_Events[g_Sim_EventsHead].Time - g_Sim_Statistics.Time;
+        }
+        if((Wake_Up == SIM_NEVER) && (g_Sim_EndTime == SIM_NEVER))
+        {
+            Sim_Finish("sleeping without a wake-up source");
+        }
+        Sim_Elapse((Wake_Up == 0) ? 1 : Wake_Up);
+    }
+
+    g_Sim_Sleeping = FALSE;
+    Sim_Dispatch();
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_Barrier
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function behind DMB / DSB / ISB, applies the last register write.
+ ************************************************************************************/
+void Sim_Barrier(void)
+{
+    Sim_Step();
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Vectors - Handlers indexed by exception number, VTOR points at them after reset
+ *                , a_Observer - Callbacks for the outputs (members can be NULL_PTR)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize the registers to their reset values. Must be called before the firmware.
+ ************************************************************************************/
+void Sim_Init(const Sim_HandlerType *a_Vectors, const Sim_ObserverType *a_Observer)
+{
+    Sim_PortType Port;
+
+    memset(g_Sim_Peripherals, 0, sizeof(g_Sim_Peripherals));
+    memset(g_Sim_System, 0, sizeof(g_Sim_System));
+    memset(&g_Sim_Statistics, 0, sizeof(g_Sim_Statistics));
+
+    g_Sim_Observer = *a_Observer;
+    g_Sim_EndTime = SIM_NEVER;
+
+    /* Reset values used by the drivers, the core starts on PIOSC */
+    *Sim_Cell(SIM_SYSCTL_RCC2) = 0x07C06810;
+    *Sim_Cell(0x400FE060) = 0x078E3AD1;
+    *Sim_Cell(SIM_DWT_CTRL) = 0x40000000;
+    *Sim_Cell(SIM_SCB_VTOR) = (uint32)(uintptr_t)a_Vectors;
+    /* 8 MPU regions ... the regions are stored but the accesses are not checked */
+    *Sim_Cell(SIM_MPU_TYPE) = 0x00000800;
+    for(Port = SIM_PORT_A; Port < SIM_PORTS_COUNT; Port++)
+    {
+        /* The inputs are pulled high until the scenario drives them */
+        g_Sim_Gpio[Port].Input = 0xFF;
+    }
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_SetEndTime
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Time - Virtual time in picoseconds ending the run
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to end the run with Sim_Finish when the virtual time reaches a_Time.
+ ************************************************************************************/
+void Sim_SetEndTime(uint64 a_Time)
+{
+    g_Sim_EndTime = a_Time;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_ScheduleEvent
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Time - Virtual time of the event in picoseconds
+ *                , a_Kind - GPIO input level or received byte
+ *                , a_Port - GPIO port (SIM_EVENT_GPIO_LEVEL)
+ *                , a_Pin - GPIO pin (SIM_EVENT_GPIO_LEVEL)
+ *                , a_Value - Level of the pin or received byte
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the events table is full
+ * Description: Function to inject an input, the inputs are pulled high until driven.
+ ************************************************************************************/
+boolean Sim_ScheduleEvent(uint64 a_Time, Sim_EventKindType a_Kind, Sim_PortType a_Port, uint8 a_Pin, uint8 a_Value)
+{
+    uint32 Index;
+
+    if(g_Sim_EventsCount == SIM_MAX_EVENTS)
+    {
+        return FALSE;
+    }
+
+    /* Insertion keeps the events of the same time in their order */
+    Index = g_Sim_EventsCount++;
+    while((Index > g_Sim_EventsHead) && (g_Sim_Events[Index - 1].Time > a_Time))
+    {
+        g_Sim_Events[Index] = g_Sim_Events[Index - 1];
+        Index--;
+    }
+    g_Sim_Events[Index].Time = a_Time;
+    g_Sim_Events[Index].Kind = a_Kind;
+    g_Sim_Events[Index].Port = a_Port;
+    g_Sim_Events[Index].Pin = a_Pin;
+    g_Sim_Events[Index].Value = a_Value;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_ReturnFromException
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to leave the active exception without returning from its handler, used
+ *              by the kernel port when PendSV starts a new task on its own host stack.
+ ************************************************************************************/
+void Sim_ReturnFromException(void)
+{
+    Sim_CompleteAccess();
+    Sim_ExitException();
+    Sim_Dispatch();
+}
+
+
+/************************************************************************************
+ * Service Name: Sim_GetStatistics
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: const Sim_StatisticsType * - Counters of the run
+ * Description: Function to get the virtual time and the activity counters.
+ ************************************************************************************/
+const Sim_StatisticsType *Sim_GetStatistics(void)
+{
+    return &g_Sim_Statistics;
+}
@@ -0,0 +1,283 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Sim.h                                                                     *
+ * [DESCRIPTION]    :           Header file for the host simulation of the TM4C123GH6PM - virtual time    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef SIM_H_
+#define SIM_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Modelled address ranges, one word of host memory per register */
+#define SIM_PERIPHERALS_BASE          0x40000000
+#define SIM_SYSTEM_BASE               0xE0000000
+#define SIM_RANGE_SIZE                0x00100000
+
+/* Virtual time unit ... every supported system clock (400 MHz / SYSDIV) has an integral period */
+#define SIM_PICOSECONDS_PER_MS        1000000000ULL
+
+/* Core cycles charged for each register access, the code between two accesses takes no time */
+#define SIM_CYCLES_PER_ACCESS         4
+
+#define SIM_VECTORS_COUNT             155
+#define SIM_PENDSV_VECTOR             14
+#define SIM_SYSTICK_VECTOR            15
+#define SIM_IRQ_VECTOR(IRQ)           ((IRQ) + 16)
+
+/* Scheduled inputs kept at the same time */
+#define SIM_MAX_EVENTS                256
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef void (*Sim_HandlerType)(void);
+
+typedef enum
+{
+    SIM_EVENT_GPIO_LEVEL,           /* Drive an input pin */
+    SIM_EVENT_UART0_RX              /* Receive a byte on UART0 */
+}Sim_EventKindType;
+
+/* GPIO ports in the order of the vector table */
+typedef enum
+{
+    SIM_PORT_A,
+    SIM_PORT_B,
+    SIM_PORT_C,
+    SIM_PORT_D,
+    SIM_PORT_E,
+    SIM_PORT_F,
+    SIM_PORTS_COUNT
+}Sim_PortType;
+
+/* Observer of the outputs ... a_Time is the virtual time in picoseconds */
+typedef struct
+{
+    void (*GpioOutput)(uint64 a_Time, Sim_PortType a_Port, uint8 a_Levels);
+    void (*Uart0Transmit)(uint64 a_Time, uint8 a_Byte);
+}Sim_ObserverType;
+
+/* Counters reported at the end of a run */
+typedef struct
+{
+    uint64 Time;                                /* Virtual time in picoseconds */
+    uint64 SleepTime;                           /* Part of Time spent in WFI */
+    uint64 Accesses;                            /* Register accesses */
+    uint64 Exceptions[SIM_VECTORS_COUNT];       /* Handlers executed per vector */
+    uint64 Uart0Bytes;                          /* Bytes transmitted on UART0 */
+}Sim_StatisticsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Sim_Register
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Address - Address of the register
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: volatile uint32 * - Host word of the register
+* Description: Function behind HW_REGISTER in the host build. The write to the previous register
+*              is applied, the time of the access elapses and the pending interrupts are taken,
+*              then the value of the register is refreshed for the caller.
+************************************************************************************/
+volatile uint32 *Sim_Register(uint32 a_Address);
+
+
+/************************************************************************************
+* Service Name: Sim_SetPrimask
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Primask - 1 to mask the exceptions, 0 to take the pending ones
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind CPSID I / CPSIE I and MSR PRIMASK in the host build.
+************************************************************************************/
+void Sim_SetPrimask(uint32 a_Primask);
+
+
+/************************************************************************************
+* Service Name: Sim_GetPrimask
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current PRIMASK
+* Description: Function behind MRS PRIMASK in the host build.
+************************************************************************************/
+uint32 Sim_GetPrimask(void);
+
+
+/************************************************************************************
+* Service Name: Sim_SetBasepri
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Basepri - Masking level, 0 to mask nothing
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind MSR BASEPRI in the host build.
+************************************************************************************/
+void Sim_SetBasepri(uint32 a_Basepri);
+
+
+/************************************************************************************
+* Service Name: Sim_SetBasepriMax
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Basepri - Masking level, ignored if it does not raise the current one
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind MSR BASEPRI_MAX in the host build.
+************************************************************************************/
+void Sim_SetBasepriMax(uint32 a_Basepri);
+
+
+/************************************************************************************
+* Service Name: Sim_GetBasepri
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current BASEPRI
+* Description: Function behind MRS BASEPRI in the host build.
+************************************************************************************/
+uint32 Sim_GetBasepri(void);
+
+
+/************************************************************************************
+* Service Name: Sim_SetFaultmask
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Faultmask - FAULTMASK value
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind CPSID F / CPSIE F, the faults are not modelled.
+************************************************************************************/
+void Sim_SetFaultmask(uint32 a_Faultmask);
+
+
+/************************************************************************************
+* Service Name: Sim_WaitForInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind WFI in the host build. The virtual time jumps to the next SysTick
+*              wrap or scheduled input until an interrupt is pending, even a masked one. The run
+*              ends if nothing can wake up the processor.
+************************************************************************************/
+void Sim_WaitForInterrupt(void);
+
+
+/************************************************************************************
+* Service Name: Sim_Barrier
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function behind DMB / DSB / ISB, applies the last register write.
+************************************************************************************/
+void Sim_Barrier(void);
+
+
+/************************************************************************************
+* Service Name: Sim_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Vectors - Handlers indexed by exception number, VTOR points at them after reset
+*                , a_Observer - Callbacks for the outputs (members can be NULL_PTR)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize the registers to their reset values. Must be called before the firmware.
+************************************************************************************/
+void Sim_Init(const Sim_HandlerType *a_Vectors, const Sim_ObserverType *a_Observer);
+
+
+/************************************************************************************
+* Service Name: Sim_SetEndTime
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Time - Virtual time in picoseconds ending the run
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to end the run with Sim_Finish when the virtual time reaches a_Time.
+************************************************************************************/
+void Sim_SetEndTime(uint64 a_Time);
+
+
+/************************************************************************************
+* Service Name: Sim_ScheduleEvent
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Time - Virtual time of the event in picoseconds
+*                , a_Kind - GPIO input level or received byte
+*                , a_Port - GPIO port (SIM_EVENT_GPIO_LEVEL)
+*                , a_Pin - GPIO pin (SIM_EVENT_GPIO_LEVEL)
+*                , a_Value - Level of the pin or received byte
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the events table is full
+* Description: Function to inject an input, the inputs are pulled high until driven.
+************************************************************************************/
+boolean Sim_ScheduleEvent(uint64 a_Time, Sim_EventKindType a_Kind, Sim_PortType a_Port, uint8 a_Pin, uint8 a_Value);
+
+
+/************************************************************************************
+* Service Name: Sim_ReturnFromException
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to leave the active exception without returning from its handler, used
+*              by the kernel port when PendSV starts a new task on its own host stack.
+************************************************************************************/
+void Sim_ReturnFromException(void);
+
+
+/************************************************************************************
+* Service Name: Sim_GetStatistics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const Sim_StatisticsType * - Counters of the run
+* Description: Function to get the virtual time and the activity counters.
+************************************************************************************/
+const Sim_StatisticsType *Sim_GetStatistics(void);
+
+
+/************************************************************************************
+* Service Name: Sim_Finish
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Reason - Why the run ends
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function implemented by the scenario runner, called at the end time or when the
+*              processor can never wake up. It must not return.
+************************************************************************************/
+void Sim_Finish(const char *a_Reason);
+
+#endif /* SIM_H_ */
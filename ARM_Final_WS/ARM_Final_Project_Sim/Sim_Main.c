@@ -0,0 +1,221 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Sim_Main.c                                                                *
+ * [DESCRIPTION]    :           Scenario runner of the host simulation - inputs, traces and report        *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Sim.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define SIM_DEFAULT_TIME_MS           20000
+#define SIM_DEFAULT_PRESS_MS          100
+
+/* Spacing of the injected bytes, about 115200 baud */
+#define SIM_RX_BYTE_TIME              (87 * 1000000ULL)
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/* main() of the firmware, renamed by the Makefile */
+int App_Main(void);
+
+extern const Sim_HandlerType g_Sim_Vectors[SIM_VECTORS_COUNT];
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static FILE *g_Sim_Uart0File = NULL_PTR;
+static boolean g_Sim_Quiet = FALSE;
+static struct timespec g_Sim_HostStart;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static double Sim_Milliseconds(uint64 a_Time)
+{
+    return (double)a_Time / (double)SIM_PICOSECONDS_PER_MS;
+}
+
+static void Sim_TraceGpio(uint64 a_Time, Sim_PortType a_Port, uint8 a_Levels)
+{
+    if(g_Sim_Quiet == FALSE)
+    {
+        printf("%14.6f ms  GPIO%c = 0x%02X\n", Sim_Milliseconds(a_Time), 'A' + a_Port, a_Levels);
+    }
+}
+
+static void Sim_TraceUart0(uint64 a_Time, uint8 a_Byte)
+{
+    (void)a_Time;
+    if(g_Sim_Uart0File != NULL_PTR)
+    {
+        fputc(a_Byte, g_Sim_Uart0File);
+    }
+}
+
+static void Sim_Usage(const char *a_Program)
+{
+    fprintf(stderr,
+            "usage: %s [--time MS] [--press PIN@MS[+MS]]... [--rx MS:TEXT]... [--uart0 FILE] [--quiet]\n"
+            "  --time MS            virtual time of the run (default %u ms)\n"
+            "  --press F0@3000+200  drive PF0 low at 3000 ms and release it 200 ms later\n"
+            "  --rx 1000:hello      receive the text on UART0 from 1000 ms\n"
+            "  --uart0 FILE         write the bytes sent on UART0 (tools/log_decoder.py decode)\n"
+            "  --quiet              do not trace the GPIO outputs\n",
+            a_Program, SIM_DEFAULT_TIME_MS);
+    exit(2);
+}
+
+/* PIN@MS[+MS] ... a button pulled up to the supply, pressed low */
+static boolean Sim_ParsePress(const char *a_Text)
+{
+    char Port;
+    unsigned int Pin;
+    double At;
+    double Hold = SIM_DEFAULT_PRESS_MS;
+    uint64 Time;
+
+    if((sscanf(a_Text, "%c%u@%lf+%lf", &Port, &Pin, &At, &Hold) < 3) ||
+       (Port < 'A') || (Port > 'F') || (Pin > 7))
+    {
+        return FALSE;
+    }
+    Time = (uint64)(At * SIM_PICOSECONDS_PER_MS);
+    return (Sim_ScheduleEvent(Time, SIM_EVENT_GPIO_LEVEL, (Sim_PortType)(Port - 'A'), (uint8)Pin, 0) == TRUE) &&
+           (Sim_ScheduleEvent(Time + (uint64)(Hold * SIM_PICOSECONDS_PER_MS), SIM_EVENT_GPIO_LEVEL,
+                              (Sim_PortType)(Port - 'A'), (uint8)Pin, 1) == TRUE);
+}
+
+/* MS:TEXT */
+static boolean Sim_ParseRx(const char *a_Text)
+{
+    const char *Separator = strchr(a_Text, ':');
+    uint64 Time;
+
+    if(Separator == NULL_PTR)
+    {
+        return FALSE;
+    }
+    Time = (uint64)(atof(a_Text) * SIM_PICOSECONDS_PER_MS);
+    for(Separator++; *Separator != '\0'; Separator++)
+    {
+        if(Sim_ScheduleEvent(Time, SIM_EVENT_UART0_RX, SIM_PORT_A, 0, (uint8)*Separator) == FALSE)
+        {
+            return FALSE;
+        }
+        Time += SIM_RX_BYTE_TIME;
+    }
+    return TRUE;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Sim_Finish
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Reason - Why the run ends
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to report the virtual and host times and the activity of the run, then exit.
+ ************************************************************************************/
+void Sim_Finish(const char *a_Reason)
+{
+    const Sim_StatisticsType *Statistics = Sim_GetStatistics();
+    struct timespec Host_End;
+    double Host_Ms;
+    uint32 Vector;
+
+    clock_gettime(CLOCK_MONOTONIC, &Host_End);
+    Host_Ms = ((double)(Host_End.tv_sec - g_Sim_HostStart.tv_sec) * 1000.0) +
+              ((double)(Host_End.tv_nsec - g_Sim_HostStart.tv_nsec) / 1000000.0);
+
+    printf("sim: %s\n", a_Reason);
+    printf("  virtual time      %14.3f ms (asleep %.1f %%)\n", Sim_Milliseconds(Statistics->Time),
+           (Statistics->Time != 0) ? (100.0 * (double)Statistics->SleepTime / (double)Statistics->Time) : 0.0);
+    printf("  host time         %14.3f ms (x %.0f)\n", Host_Ms,
+           (Host_Ms > 0.0) ? (Sim_Milliseconds(Statistics->Time) / Host_Ms) : 0.0);
+    printf("  register accesses %14llu\n", Statistics->Accesses);
+    printf("  UART0 bytes       %14llu\n", Statistics->Uart0Bytes);
+    for(Vector = 0; Vector < SIM_VECTORS_COUNT; Vector++)
+    {
+        if(Statistics->Exceptions[Vector] != 0)
+        {
+            printf("  vector %-3u        %14llu\n", Vector, Statistics->Exceptions[Vector]);
+        }
+    }
+
+    if(g_Sim_Uart0File != NULL_PTR)
+    {
+        fclose(g_Sim_Uart0File);
+    }
+    fflush(stdout);
+    exit(0);
+}
+
+
+int main(int argc, char **argv)
+{
+    static const Sim_ObserverType Observer = {Sim_TraceGpio, Sim_TraceUart0};
+    double Time_Ms = SIM_DEFAULT_TIME_MS;
+    int Index;
+
+    Sim_Init(g_Sim_Vectors, &Observer);
+
+    for(Index = 1; Index < argc; Index++)
+    {
+        if((strcmp(argv[Index], "--time") == 0) && ((Index + 1) < argc))
+        {
+            Time_Ms = atof(argv[++Index]);
+        }
+        else if((strcmp(argv[Index], "--press") == 0) && ((Index + 1) < argc))
+        {
+            if(Sim_ParsePress(argv[++Index]) == FALSE)
+            {
+                Sim_Usage(argv[0]);
+            }
+        }
+        else if((strcmp(argv[Index], "--rx") == 0) && ((Index + 1) < argc))
+        {
+            if(Sim_ParseRx(argv[++Index]) == FALSE)
+            {
+                Sim_Usage(argv[0]);
+            }
+        }
+        else if((strcmp(argv[Index], "--uart0") == 0) && ((Index + 1) < argc))
+        {
+            g_Sim_Uart0File = fopen(argv[++Index], "wb");
+            if(g_Sim_Uart0File == NULL_PTR)
+            {
+                perror(argv[Index]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[Index], "--quiet") == 0)
+        {
+            g_Sim_Quiet = TRUE;
+        }
+        else
+        {
+            Sim_Usage(argv[0]);
+        }
+    }
+    Sim_SetEndTime((uint64)(Time_Ms * SIM_PICOSECONDS_PER_MS));
+
+    /* The firmware never returns, the run ends in Sim_Finish */
+    clock_gettime(CLOCK_MONOTONIC, &g_Sim_HostStart);
+    App_Main();
+    Sim_Finish("main() returned");
+
+    return 0;
+}
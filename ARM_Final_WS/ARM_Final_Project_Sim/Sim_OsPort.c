@@ -0,0 +1,148 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Sim_OsPort.c                                                              *
+ * [DESCRIPTION]    :           PendSV handler of the kernel for the host simulation - replaces Os_Port   *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include "Sim.h"
+#include "Os.h"
+#include "Deferred.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Every task runs on a host stack, the stack given to Os_CreateTask only holds the initial frame */
+#define SIM_OS_TASKS_COUNT            (OS_PRIORITIES_COUNT + 1)
+#define SIM_OS_STACK_SIZE             (256 * 1024)
+
+/* Words of the initial frame built by Os_CreateTask */
+#define SIM_OS_FRAME_ARGUMENT         9
+#define SIM_OS_FRAME_EXIT             14
+#define SIM_OS_FRAME_ENTRY            15
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    Os_TaskType *Task;
+    ucontext_t Context;
+    void *Stack;
+    Os_TaskEntryType Entry;
+    void *Argument;
+    void (*Exit)(void);
+}Sim_OsContextType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+extern Os_TaskType *volatile g_Os_CurrentTask;
+extern Os_TaskType *volatile g_Os_NextTask;
+
+static Sim_OsContextType g_Sim_OsContexts[SIM_OS_TASKS_COUNT];
+
+/* Context of main(), left on the first switch */
+static ucontext_t g_Sim_OsMainContext;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* First instructions of a task ... the exception return of the PendSV that started it */
+static void Sim_OsTaskStart(int a_Index)
+{
+    Sim_OsContextType *Context = &g_Sim_OsContexts[a_Index];
+
+    Sim_SetPrimask(0);
+    Sim_ReturnFromException();
+
+    Context->Entry(Context->Argument);
+    Context->Exit();
+}
+
+/* Host context of a task, a new one is made when Os_CreateTask built a new initial frame */
+static ucontext_t *Sim_OsGetContext(Os_TaskType *a_Task)
+{
+    Sim_OsContextType *Context = NULL_PTR;
+    uint32 *Frame = a_Task->StackPointer;
+    uint32 Index;
+
+    for(Index = 0; Index < SIM_OS_TASKS_COUNT; Index++)
+    {
+        if((g_Sim_OsContexts[Index].Task == a_Task) || ((Context == NULL_PTR) && (g_Sim_OsContexts[Index].Task == NULL_PTR)))
+        {
+            Context = &g_Sim_OsContexts[Index];
+        }
+    }
+    if(Context == NULL_PTR)
+    {
+        fprintf(stderr, "sim: too many tasks\n");
+        abort();
+    }
+    if(Frame == NULL_PTR)
+    {
+        return &Context->Context;
+    }
+
+    /* The frame is consumed, the saved stack pointer of a running task is not used on the host */
+    a_Task->StackPointer = NULL_PTR;
+    Context->Task = a_Task;
+    Context->Entry = (Os_TaskEntryType)(uintptr_t)Frame[SIM_OS_FRAME_ENTRY];
+    Context->Argument = (void *)(uintptr_t)Frame[SIM_OS_FRAME_ARGUMENT];
+    Context->Exit = (void (*)(void))(uintptr_t)Frame[SIM_OS_FRAME_EXIT];
+    if(Context->Stack == NULL_PTR)
+    {
+        Context->Stack = malloc(SIM_OS_STACK_SIZE);
+    }
+
+    getcontext(&Context->Context);
+    Context->Context.uc_stack.ss_sp = Context->Stack;
+    Context->Context.uc_stack.ss_size = SIM_OS_STACK_SIZE;
+    Context->Context.uc_link = NULL_PTR;
+    makecontext(&Context->Context, (void (*)(void))Sim_OsTaskStart, 1, (int)(Context - g_Sim_OsContexts));
+
+    return &Context->Context;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: PendSV_Handler
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Handler for PendSV exception (lowest priority). Executes the deferred work, then
+ *              switches the host context to g_Os_NextTask like Os_Port.asm does on the target.
+ ************************************************************************************/
+void PendSV_Handler(void)
+{
+    Os_TaskType *Current;
+    Os_TaskType *Next;
+    ucontext_t *From;
+
+    /* Bottom halves first, they can make a task ready */
+    Deferred_ProcessWork();
+
+    Sim_SetPrimask(1);
+    Current = g_Os_CurrentTask;
+    Next = g_Os_NextTask;
+
+    if(Current != Next)
+    {
+        /* No running task on the first switch, main() is never resumed */
+        From = (Current == NULL_PTR) ? &g_Sim_OsMainContext : Sim_OsGetContext(Current);
+        g_Os_CurrentTask = Next;
+        swapcontext(From, Sim_OsGetContext(Next));
+    }
+
+    Sim_SetPrimask(0);
+}
@@ -0,0 +1,35 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Sim_Vectors.c                                                             *
+ * [DESCRIPTION]    :           Vector table of the host simulation - mirrors tm4c123gh6pm_startup_ccs.c  *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Sim.h"
+#include "Stack.h"
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/* Handlers of the firmware, a handler added to the startup file must be added here too */
+extern void PendSV_Handler(void);
+extern void SysTick_Handler(void);
+extern void UART0_Handler(void);
+extern void GPIOPortF_Handler(void);
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Stands for the .stack section of the linker, the firmware guards it but the host never runs on it */
+uint32 __stack[STACK_MAIN_BYTES / 4] __attribute__((aligned(32)));
+
+/* Flash vector table of the host build, VTOR points at it after reset and the firmware can copy it
+ * to its SRAM table. The unused vectors stay NULL_PTR, the simulation stops if one of them is taken */
+const Sim_HandlerType g_Sim_Vectors[SIM_VECTORS_COUNT] =
+{
+    [SIM_PENDSV_VECTOR]     = PendSV_Handler,
+    [SIM_SYSTICK_VECTOR]    = SysTick_Handler,
+    [SIM_IRQ_VECTOR(5)]     = UART0_Handler,
+    [SIM_IRQ_VECTOR(30)]    = GPIOPortF_Handler,
+};
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+[FILE NAME]      :   sim_check.py
+[DESCRIPTION]    :   Regression check of the LEDs timeline traced by the host simulation
+[DATE CREATED]   :   OCT 17, 2026
+[AURTHOR]        :   Alaa Mekawi
+
+The simulator is run with the given arguments and its GPIOF trace is checked against the
+application timing (main.c), make check runs the scenarios:
+    python3 sim_check.py build/sim --time 12000 --press F0@3000+200
+
+    - The LEDs step through Red, Blue and Green every period (LEDS_PERIOD_TICKS).
+    - A SW2 (PF0) press turns all the LEDs on after the debounce (3 samples of the 10 ms tick).
+    - The LEDs stay on for the hold (LEDS_HOLD_TICKS) from the press, a press during the hold
+      extends it from its own tick, and the sequence continues one period after the hold.
+    - No step is missing at the end of the run.
+
+The writes done before the first step (GPIO benchmark at boot) are ignored. Every time is checked
+within one tick, the exit status is not zero on the first mismatch. The options of the check come
+before the simulator command, everything after it is passed to the simulator.
+"""
+import argparse
+import re
+import subprocess
+import sys
+
+LEDS_SEQUENCE = [0x02, 0x04, 0x08]
+LEDS_ALL = 0x0E
+
+TRACE_PATTERN = re.compile(r"^\s*([0-9.]+) ms  GPIOF = 0x([0-9A-F]{2})$")
+END_PATTERN = re.compile(r"^\s*virtual time\s+([0-9.]+) ms")
+PRESS_PATTERN = re.compile(r"^F0@([0-9.]+)(\+[0-9.]+)?$")
+
+
+def run_simulation(command):
+    result = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        sys.exit("simulation failed with status %d" % result.returncode)
+
+    events = []
+    end = None
+    for line in result.stdout.splitlines():
+        match = TRACE_PATTERN.match(line)
+        if match:
+            events.append((float(match.group(1)), int(match.group(2), 16)))
+            continue
+        match = END_PATTERN.match(line)
+        if match:
+            end = float(match.group(1))
+    if end is None:
+        sys.exit("no end of run in the simulation output")
+    return events, end
+
+
+def sw2_presses(command):
+    presses = []
+    for index, argument in enumerate(command[:-1]):
+        if argument == "--press":
+            match = PRESS_PATTERN.match(command[index + 1])
+            if match:
+                presses.append(float(match.group(1)))
+    return sorted(presses)
+
+
+def check(events, end, presses, arguments):
+    tolerance = arguments.tolerance
+    expected = arguments.period
+    step = 0
+    hold_end = None
+
+    for time, levels in events:
+        if time < arguments.period / 2:
+            continue
+
+        if levels == LEDS_ALL:
+            if hold_end is not None or not presses:
+                sys.exit("%.3f ms: LEDs on without a SW2 press" % time)
+            press = presses.pop(0)
+            debounce = time - press
+            if abs(debounce - arguments.debounce) > tolerance:
+                sys.exit("%.3f ms: LEDs on %.3f ms after the press at %.3f ms, expected %.3f ms"
+                         % (time, debounce, press, arguments.debounce))
+            hold_end = time + arguments.hold
+            # A press debounced before the end of the hold extends it from its own tick
+            while presses and (presses[0] + debounce) < hold_end:
+                hold_end = presses.pop(0) + debounce + arguments.hold
+            expected = hold_end + arguments.period
+            continue
+
+        if levels != LEDS_SEQUENCE[step % len(LEDS_SEQUENCE)]:
+            sys.exit("%.3f ms: GPIOF = 0x%02X, expected 0x%02X"
+                     % (time, levels, LEDS_SEQUENCE[step % len(LEDS_SEQUENCE)]))
+        if abs(time - expected) > tolerance:
+            sys.exit("%.3f ms: step 0x%02X, expected at %.3f ms" % (time, levels, expected))
+        step += 1
+        expected = time + arguments.period
+        hold_end = None
+
+    if (expected + tolerance) < end:
+        sys.exit("no step at %.3f ms, the run ends at %.3f ms" % (expected, end))
+    if presses:
+        sys.exit("no LEDs hold for the SW2 press at %.3f ms" % presses[0])
+    print("sim_check: %d steps and the holds of the run (%.0f ms) match" % (step, end))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--period", type=float, default=1000.0, metavar="MS", help="LEDs step period")
+    parser.add_argument("--hold", type=float, default=5000.0, metavar="MS", help="LEDs hold after a press")
+    parser.add_argument("--debounce", type=float, default=30.0, metavar="MS", help="press to LEDs on")
+    parser.add_argument("--tolerance", type=float, default=10.0, metavar="MS", help="one SysTick tick")
+    parser.add_argument("command", nargs=argparse.REMAINDER, help="simulator and its arguments")
+    arguments = parser.parse_args()
+    if not arguments.command:
+        parser.error("no simulator command")
+
+    events, end = run_simulation(arguments.command)
+    check(events, end, sw2_presses(arguments.command), arguments)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,288 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Button.c                                                                  *
+ * [DESCRIPTION]    :           Source file for the debounced buttons - press, release, long press events *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Button.h"
+#include "SwTimer.h"
+#include "NVIC.h"
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Buttons of a port, filtered together ... one bit per pin in every field */
+typedef struct
+{
+    Gpio_PinsType Pins;
+    Gpio_PinsType ActiveLow;
+    uint8         Count0;       /* Vertical counter, bit 0 and bit 1 of the counter of each pin */
+    uint8         Count1;
+    Gpio_PinsType Pressed;      /* Debounced state */
+    uint8         Buttons[8];   /* Index of the button of each pin */
+}Button_PortType;
+
+typedef struct
+{
+    uint16  Ticks;              /* Ticks held, or ticks left for the second click */
+    boolean LongPress;          /* BUTTON_EVENT_LONG_PRESS sent for the current press */
+    boolean ClickPending;       /* Released after a short press, a press now is a double click */
+}Button_StateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static Button_PortType g_Button_Ports[GPIO_PORTS_COUNT];
+static Button_StateType g_Button_States[BUTTON_MAX_COUNT];
+static Button_CallBackType g_Button_CallBack = NULL_PTR;
+
+/* Buttons held or waiting for their second click, the only ones timed on each sample */
+static uint32 g_Button_Timed = 0;
+
+static SwTimer_Type g_Button_Timer;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Pins pressed now on a port, not debounced */
+static Gpio_PinsType Button_ReadPort(Gpio_PortType a_Port)
+{
+    return (Gpio_PinsType)(Gpio_ReadPins(a_Port, g_Button_Ports[a_Port].Pins) ^ g_Button_Ports[a_Port].ActiveLow);
+}
+
+/* Debounced change of a button */
+static void Button_Change(uint8 a_Button, boolean a_Pressed)
+{
+    Button_StateType *State = &g_Button_States[a_Button];
+
+    if(a_Pressed == TRUE)
+    {
+        g_Button_CallBack(a_Button, BUTTON_EVENT_PRESS);
+        if(State->ClickPending == TRUE)
+        {
+            g_Button_CallBack(a_Button, BUTTON_EVENT_DOUBLE_CLICK);
+        }
+        State->Ticks = 0;
+        State->LongPress = FALSE;
+        State->ClickPending = FALSE;
+        g_Button_Timed |= (1UL << a_Button);
+    }
+    else
+    {
+        g_Button_CallBack(a_Button, BUTTON_EVENT_RELEASE);
+        if(State->LongPress == FALSE)
+        {
+            State->Ticks = BUTTON_DOUBLE_CLICK_TICKS;
+            State->ClickPending = TRUE;
+        }
+        else
+        {
+            g_Button_Timed &= ~(1UL << a_Button);
+        }
+    }
+}
+
+/* Long press and double click timing of a held or released button */
+static void Button_Time(uint8 a_Button)
+{
+    Button_StateType *State = &g_Button_States[a_Button];
+
+    if(State->ClickPending == TRUE)
+    {
+        State->Ticks--;
+        if(State->Ticks == 0)
+        {
+            State->ClickPending = FALSE;
+            g_Button_Timed &= ~(1UL << a_Button);
+        }
+    }
+    else if(State->LongPress == FALSE)
+    {
+        State->Ticks++;
+        if(State->Ticks == BUTTON_LONG_PRESS_TICKS)
+        {
+            State->LongPress = TRUE;
+            g_Button_CallBack(a_Button, BUTTON_EVENT_LONG_PRESS);
+        }
+    }
+    else
+    {
+        /* Held after the long press, nothing until the release */
+    }
+}
+
+/* Stop the sampling and wait for the next press edge ... a press since the last sample has no edge
+ * left once unmasked, it is caught by reading the pins after the unmask */
+static void Button_Sleep(void)
+{
+    Gpio_PortType Port;
+    boolean Pressed = FALSE;
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    SwTimer_Stop(&g_Button_Timer);
+    for(Port = GPIO_PORT_A; Port <= GPIO_PORT_F; Port++)
+    {
+        if(g_Button_Ports[Port].Pins != 0)
+        {
+            Gpio_EnableInterrupt(Port, g_Button_Ports[Port].Pins);
+            if(Button_ReadPort(Port) != 0)
+            {
+                Pressed = TRUE;
+            }
+        }
+    }
+    if(Pressed == TRUE)
+    {
+        Button_EdgeHandler();
+    }
+    NVIC_RestoreExceptions(Primask);
+}
+
+/* SwTimer call back, the filter costs the same for 1 or 8 buttons of a port */
+static void Button_Sample(void *a_Context)
+{
+    Button_PortType *Port_State;
+    Gpio_PortType Port;
+    Gpio_PinsType Delta;
+    Gpio_PinsType Changed;
+    Gpio_PinsType Settling = 0;
+    uint32 Timed;
+    uint8 Pin;
+
+    for(Port = GPIO_PORT_A; Port <= GPIO_PORT_F; Port++)
+    {
+        Port_State = &g_Button_Ports[Port];
+        if(Port_State->Pins == 0)
+        {
+            continue;
+        }
+
+        /* The counter of a pin equal to its debounced state is reset to 3, it counts down while the pin
+         * differs and the state toggles when it wraps from 0 to 3 */
+        Delta = (Gpio_PinsType)(Button_ReadPort(Port) ^ Port_State->Pressed);
+        Port_State->Count0 = (uint8)~(Port_State->Count0 & Delta);
+        Port_State->Count1 = (uint8)(Port_State->Count0 ^ (Port_State->Count1 & Delta));
+        Changed = (Gpio_PinsType)(Delta & Port_State->Count0 & Port_State->Count1);
+        Port_State->Pressed ^= Changed;
+        Settling |= (Gpio_PinsType)(Delta & ~Changed);
+
+        while(Changed != 0)
+        {
+            for(Pin = 0; (Changed & (1 << Pin)) == 0; Pin++);
+            Changed &= (Gpio_PinsType)~(1 << Pin);
+            Button_Change(Port_State->Buttons[Pin], (boolean)((Port_State->Pressed & (1 << Pin)) != 0));
+        }
+    }
+
+    /* Only the active buttons are timed */
+    Timed = g_Button_Timed;
+    for(Pin = 0; Timed != 0; Pin++, Timed >>= 1)
+    {
+        if(Timed & 1)
+        {
+            Button_Time(Pin);
+        }
+    }
+
+    if((Settling == 0) && (g_Button_Timed == 0))
+    {
+        Button_Sleep();
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Button_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Table - Buttons, one pin each
+ *                , a_Count - Number of buttons, up to BUTTON_MAX_COUNT
+ *                , a_CallBack - Function receiving the events
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if there are too many buttons or an entry is not one pin
+ * Description: Function to configure the press edge interrupt of the buttons. The IRQs of their
+ *              ports are enabled in the NVIC by the caller and their handlers call
+ *              Button_EdgeHandler. Must be called after SwTimer_Init.
+ ************************************************************************************/
+boolean Button_Init(const Button_ConfigType *a_Table, uint8 a_Count, Button_CallBackType a_CallBack)
+{
+    const Button_ConfigType *Button;
+    Button_PortType *Port_State;
+    uint8 Index;
+    uint8 Pin;
+
+    if(a_Count > BUTTON_MAX_COUNT)
+    {
+        return FALSE;
+    }
+    for(Index = 0; Index < a_Count; Index++)
+    {
+        /* One pin per button */
+        if((a_Table[Index].Pin == 0) || ((a_Table[Index].Pin & (a_Table[Index].Pin - 1)) != 0))
+        {
+            return FALSE;
+        }
+    }
+
+    g_Button_CallBack = a_CallBack;
+    g_Button_Timed = 0;
+    SwTimer_Create(&g_Button_Timer, Button_Sample, NULL_PTR);
+
+    for(Index = 0; Index < a_Count; Index++)
+    {
+        Button = &a_Table[Index];
+        Port_State = &g_Button_Ports[Button->Port];
+        for(Pin = 0; (Button->Pin & (1 << Pin)) == 0; Pin++);
+
+        Port_State->Pins |= Button->Pin;
+        Port_State->ActiveLow |= (Button->ActiveLow == TRUE) ? Button->Pin : 0;
+        Port_State->Count0 |= Button->Pin;
+        Port_State->Count1 |= Button->Pin;
+        Port_State->Buttons[Pin] = Index;
+
+        Gpio_ConfigureInterrupt(Button->Port, Button->Pin,
+                                (Button->ActiveLow == TRUE) ? GPIO_EDGE_FALLING : GPIO_EDGE_RISING);
+        Gpio_DisableInterrupt(Button->Port, Button->Pin);
+    }
+
+    /* Unmask the edges, or sample at once the buttons already held */
+    Button_Sleep();
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Button_EdgeHandler
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function called by the GPIO handlers of the buttons ports. The edge interrupts of all
+ *              the buttons are masked and the sampling starts, it stops and unmasks them again once
+ *              the buttons are released and no event is pending, so a bouncing contact interrupts once.
+ ************************************************************************************/
+void Button_EdgeHandler(void)
+{
+    Gpio_PortType Port;
+
+    for(Port = GPIO_PORT_A; Port <= GPIO_PORT_F; Port++)
+    {
+        if(g_Button_Ports[Port].Pins != 0)
+        {
+            Gpio_DisableInterrupt(Port, g_Button_Ports[Port].Pins);
+        }
+    }
+
+    if(SwTimer_IsActive(&g_Button_Timer) == FALSE)
+    {
+        SwTimer_Start(&g_Button_Timer, BUTTON_SAMPLE_TICKS, BUTTON_SAMPLE_TICKS);
+    }
+}
@@ -0,0 +1,84 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Button.h                                                                  *
+ * [DESCRIPTION]    :           Header file for the debounced buttons - press, release, long press events *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef BUTTON_H_
+#define BUTTON_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "Gpio.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Buttons of the configuration table, a bit per button in the timing mask */
+#define BUTTON_MAX_COUNT              32
+
+/* The buttons are sampled on every SysTick tick while one of them is active, a level is accepted
+ * after 4 equal samples (2-bit vertical counter): 40 ms with the 10 ms tick */
+#define BUTTON_SAMPLE_TICKS           1
+
+/* Ticks a button is held for BUTTON_EVENT_LONG_PRESS, and ticks from a release to the next press for
+ * BUTTON_EVENT_DOUBLE_CLICK ... 1 s and 300 ms with the 10 ms tick */
+#define BUTTON_LONG_PRESS_TICKS       100
+#define BUTTON_DOUBLE_CLICK_TICKS     30
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    Gpio_PortType Port;
+    Gpio_PinsType Pin;          /* Input pin configured with its pull resistor */
+    boolean       ActiveLow;    /* TRUE for a button pulling the pin to the ground */
+}Button_ConfigType;
+
+typedef enum
+{
+    BUTTON_EVENT_PRESS,
+    BUTTON_EVENT_RELEASE,
+    BUTTON_EVENT_LONG_PRESS,    /* Held for BUTTON_LONG_PRESS_TICKS, no double click follows its release */
+    BUTTON_EVENT_DOUBLE_CLICK   /* Sent after the BUTTON_EVENT_PRESS of the second click */
+}Button_EventType;
+
+/* Called from the SysTick handler, a_Button is the index of the button in the configuration table */
+typedef void (*Button_CallBackType)(uint8 a_Button, Button_EventType a_Event);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Button_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Table - Buttons, one pin each
+*                , a_Count - Number of buttons, up to BUTTON_MAX_COUNT
+*                , a_CallBack - Function receiving the events
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if there are too many buttons or an entry is not one pin
+* Description: Function to configure the press edge interrupt of the buttons. The IRQs of their
+*              ports are enabled in the NVIC by the caller and their handlers call
+*              Button_EdgeHandler. Must be called after SwTimer_Init.
+************************************************************************************/
+boolean Button_Init(const Button_ConfigType *a_Table, uint8 a_Count, Button_CallBackType a_CallBack);
+
+
+/************************************************************************************
+* Service Name: Button_EdgeHandler
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by the GPIO handlers of the buttons ports. The edge interrupts of all
+*              the buttons are masked and the sampling starts, it stops and unmasks them again once
+*              the buttons are released and no event is pending, so a bouncing contact interrupts once.
+************************************************************************************/
+void Button_EdgeHandler(void);
+
+#endif /* BUTTON_H_ */
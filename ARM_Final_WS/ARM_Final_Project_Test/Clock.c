@@ -0,0 +1,110 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Clock.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the TM4C123GH6PM clock tree (oscillators and PLL) driver  *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Clock.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* The processor runs from the PIOSC out of reset */
+static uint32 g_Clock_SystemClock = CLOCK_PIOSC_FREQUENCY;
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Clock_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Source - Oscillator used directly or as the PLL reference
+ *                , a_SystemClockFrequency - Required system clock in Hz, either the oscillator
+ *                                           frequency (PLL off) or 400 MHz / N with N = 5 .. 128
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the frequency can not be generated (the clock is not changed)
+ * Description: Function to configure the system clock using RCC2, the PLL lock is polled in PLLSTAT.
+ *              Must be called before the drivers that compute their timing from the system clock.
+ ************************************************************************************/
+boolean Clock_Init(Clock_SourceType a_Source, uint32 a_SystemClockFrequency)
+{
+    uint32 Divisor = 0;
+    boolean Use_Pll;
+
+    /* Both oscillators are 16 MHz, the PLL is used for any other frequency */
+    Use_Pll = (a_SystemClockFrequency != CLOCK_PIOSC_FREQUENCY) ? TRUE : FALSE;
+
+    if(Use_Pll == TRUE)
+    {
+        if(a_SystemClockFrequency == 0)
+        {
+            return FALSE;
+        }
+
+        Divisor = CLOCK_PLL_FREQUENCY / a_SystemClockFrequency;
+        if(((Divisor * a_SystemClockFrequency) != CLOCK_PLL_FREQUENCY) ||
+           (Divisor < CLOCK_MIN_PLL_DIVISOR) || (Divisor > CLOCK_MAX_PLL_DIVISOR))
+        {
+            return FALSE;
+        }
+    }
+
+    /* Use RCC2 and run from the raw oscillator while the PLL is re-configured */
+    SYSCTL_RCC2_REG |= RCC2_USERCC2_BIT_MASK | RCC2_BYPASS2_BIT_MASK;
+
+    /* The crystal value is also the PLL reference value when the PIOSC is used */
+    SYSCTL_RCC_REG = (SYSCTL_RCC_REG & ~RCC_XTAL_MASK) | RCC_XTAL_16MHZ;
+
+    if(a_Source == CLOCK_SOURCE_MOSC)
+    {
+        /* Enable the main oscillator and wait until it is stable */
+        SYSCTL_RCC_REG &= ~RCC_MOSCDIS_BIT_MASK;
+        while(!(SYSCTL_RIS_REG & RIS_MOSCPUPRIS_BIT_MASK));
+    }
+
+    SYSCTL_RCC2_REG = (SYSCTL_RCC2_REG & ~RCC2_OSCSRC2_MASK) | a_Source;
+
+    if(Use_Pll == TRUE)
+    {
+        /* Power up the PLL and divide the 400 MHz output by Divisor */
+        SYSCTL_RCC2_REG &= ~RCC2_PWRDN2_BIT_MASK;
+        SYSCTL_RCC2_REG = (SYSCTL_RCC2_REG & ~RCC2_SYSDIV2_MASK) | RCC2_DIV400_BIT_MASK
+                          | ((Divisor - 1) << RCC2_SYSDIV2_BITS_POS);
+        SYSCTL_RCC_REG |= RCC_USESYSDIV_BIT_MASK;
+
+        /* Wait for the PLL to lock then switch the system clock to it */
+        while(!(SYSCTL_PLLSTAT_REG & PLLSTAT_LOCK_BIT_MASK));
+        SYSCTL_RCC2_REG &= ~RCC2_BYPASS2_BIT_MASK;
+    }
+    else
+    {
+        /* Run from the oscillator without divider and power down the PLL */
+        SYSCTL_RCC_REG &= ~RCC_USESYSDIV_BIT_MASK;
+        SYSCTL_RCC2_REG |= RCC2_PWRDN2_BIT_MASK;
+    }
+
+    g_Clock_SystemClock = a_SystemClockFrequency;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Clock_GetSystemClock
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Current system clock frequency in Hz
+ * Description: Function to get the system clock frequency used by all the timing calculations.
+ ************************************************************************************/
+uint32 Clock_GetSystemClock(void)
+{
+    return g_Clock_SystemClock;
+}
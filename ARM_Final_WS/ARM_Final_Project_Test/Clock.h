@@ -0,0 +1,82 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Clock.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the TM4C123GH6PM clock tree (oscillators and PLL) driver  *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef CLOCK_H_
+#define CLOCK_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Oscillators frequencies ... the LaunchPad main oscillator is a 16 MHz crystal */
+#define CLOCK_PIOSC_FREQUENCY           16000000
+#define CLOCK_CRYSTAL_FREQUENCY         16000000
+
+/* The PLL output is 400 MHz, divided by (SYSDIV2 + 1) with DIV400 ... 80 MHz is the maximum system clock */
+#define CLOCK_PLL_FREQUENCY             400000000
+#define CLOCK_MIN_PLL_DIVISOR           5
+#define CLOCK_MAX_PLL_DIVISOR           128
+
+#define RCC_MOSCDIS_BIT_MASK            0x00000001
+#define RCC_XTAL_MASK                   0x000007C0
+#define RCC_XTAL_16MHZ                  0x00000540
+#define RCC_USESYSDIV_BIT_MASK          0x00400000
+
+#define RCC2_USERCC2_BIT_MASK           0x80000000
+#define RCC2_DIV400_BIT_MASK            0x40000000
+#define RCC2_SYSDIV2_MASK               0x1FC00000      /* SYSDIV2 and SYSDIV2LSB */
+#define RCC2_SYSDIV2_BITS_POS           22
+#define RCC2_PWRDN2_BIT_MASK            0x00002000
+#define RCC2_BYPASS2_BIT_MASK           0x00000800
+#define RCC2_OSCSRC2_MASK               0x00000070
+
+#define PLLSTAT_LOCK_BIT_MASK           0x00000001
+#define RIS_MOSCPUPRIS_BIT_MASK         0x00000100
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Values of the OSCSRC2 field */
+typedef enum
+{
+    CLOCK_SOURCE_MOSC  = 0x00,      /* Main oscillator (crystal) */
+    CLOCK_SOURCE_PIOSC = 0x10       /* Precision internal oscillator */
+}Clock_SourceType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Clock_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Source - Oscillator used directly or as the PLL reference
+*                , a_SystemClockFrequency - Required system clock in Hz, either the oscillator
+*                                           frequency (PLL off) or 400 MHz / N with N = 5 .. 128
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the frequency can not be generated (the clock is not changed)
+* Description: Function to configure the system clock using RCC2, the PLL lock is polled in PLLSTAT.
+*              Must be called before the drivers that compute their timing from the system clock.
+************************************************************************************/
+boolean Clock_Init(Clock_SourceType a_Source, uint32 a_SystemClockFrequency);
+
+
+/************************************************************************************
+* Service Name: Clock_GetSystemClock
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current system clock frequency in Hz
+* Description: Function to get the system clock frequency used by all the timing calculations.
+************************************************************************************/
+uint32 Clock_GetSystemClock(void);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,138 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Deferred.c                                                                *
+ * [DESCRIPTION]    :           Source file for the PendSV deferred work (bottom halves) service          *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Deferred.h"
+#include "NVIC.h"
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    Deferred_WorkType Work;
+    void             *Argument;
+}Deferred_ItemType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static Deferred_ItemType g_Deferred_Queue[DEFERRED_QUEUE_SIZE];
+
+/* Head is written by the ISRs posting work, Tail is written only by the PendSV handler */
+static volatile uint32 g_Deferred_Head = 0;
+static volatile uint32 g_Deferred_Tail = 0;
+
+static volatile uint32 g_Deferred_DroppedCount = 0;
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Deferred_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize the deferred work queue, called by Os_Init. The work runs in the PendSV
+ *              handler of the kernel at its lowest priority (OS_PENDSV_PRIORITY).
+ ************************************************************************************/
+void Deferred_Init(void)
+{
+    g_Deferred_Head = 0;
+    g_Deferred_Tail = 0;
+    g_Deferred_DroppedCount = 0;
+}
+
+
+/************************************************************************************
+ * Service Name: Deferred_Post
+ * Sync/Async: Asynchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Work - Function to be executed by the PendSV handler
+ *                , a_Argument - Argument passed to the function
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if the work is queued, FALSE if the queue is full
+ * Description: Function to queue a work item from an ISR (or thread mode) and pend the PendSV
+ *              exception, the work is executed once all the higher priority ISRs are finished.
+ ************************************************************************************/
+boolean Deferred_Post(Deferred_WorkType a_Work, void *a_Argument)
+{
+    uint32 Primask;
+    uint32 Head;
+
+    /* ISRs of different priorities can post at the same time ... keep the slot reservation atomic */
+    Primask = NVIC_DisableExceptionsSave();
+
+    Head = g_Deferred_Head;
+    if((Head - g_Deferred_Tail) >= DEFERRED_QUEUE_SIZE)
+    {
+        g_Deferred_DroppedCount++;
+        NVIC_RestoreExceptions(Primask);
+        return FALSE;
+    }
+
+    g_Deferred_Queue[Head & DEFERRED_QUEUE_MASK].Work = a_Work;
+    g_Deferred_Queue[Head & DEFERRED_QUEUE_MASK].Argument = a_Argument;
+    g_Deferred_Head = Head + 1;
+
+    NVIC_RestoreExceptions(Primask);
+
+    /* Pend the PendSV exception, writing zero to the other bits has no effect */
+    NVIC_SYSTEM_INTCTRL = PENDSV_PEND_BIT_MASK;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Deferred_GetDroppedCount
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of work items dropped because the queue was full
+ * Description: Function to get the number of work items that could not be queued.
+ ************************************************************************************/
+uint32 Deferred_GetDroppedCount(void)
+{
+    return g_Deferred_DroppedCount;
+}
+
+
+/************************************************************************************
+ * Service Name: Deferred_ProcessWork
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Executes all the queued work items, called by the PendSV handler (Os_Port.asm)
+ *              before the context switch so the work can make tasks ready.
+ ************************************************************************************/
+void Deferred_ProcessWork(void)
+{
+    uint32 Tail = g_Deferred_Tail;
+    Deferred_ItemType Item;
+
+    /* Work posted while draining is executed in the same activation */
+    while(Tail != g_Deferred_Head)
+    {
+        Item = g_Deferred_Queue[Tail & DEFERRED_QUEUE_MASK];
+
+        /* Free the slot before executing the work, so the work can post again */
+        Tail++;
+        g_Deferred_Tail = Tail;
+
+        Item.Work(Item.Argument);
+    }
+}
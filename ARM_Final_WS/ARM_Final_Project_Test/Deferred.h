@@ -0,0 +1,83 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Deferred.h                                                                *
+ * [DESCRIPTION]    :           Header file for the PendSV deferred work (bottom halves) service          *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef DEFERRED_H_
+#define DEFERRED_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Number of work items that can be waiting at the same time (must be a power of 2) */
+#define DEFERRED_QUEUE_SIZE           16
+#define DEFERRED_QUEUE_MASK           (DEFERRED_QUEUE_SIZE - 1)
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef void (*Deferred_WorkType)(void *a_Argument);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Deferred_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize the deferred work queue, called by Os_Init. The work runs in the PendSV
+*              handler of the kernel at its lowest priority (OS_PENDSV_PRIORITY).
+************************************************************************************/
+void Deferred_Init(void);
+
+
+/************************************************************************************
+* Service Name: Deferred_Post
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Work - Function to be executed by the PendSV handler
+*                , a_Argument - Argument passed to the function
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the work is queued, FALSE if the queue is full
+* Description: Function to queue a work item from an ISR (or thread mode) and pend the PendSV
+*              exception, the work is executed once all the higher priority ISRs are finished.
+************************************************************************************/
+boolean Deferred_Post(Deferred_WorkType a_Work, void *a_Argument);
+
+
+/************************************************************************************
+* Service Name: Deferred_GetDroppedCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of work items dropped because the queue was full
+* Description: Function to get the number of work items that could not be queued.
+************************************************************************************/
+uint32 Deferred_GetDroppedCount(void);
+
+
+/************************************************************************************
+* Service Name: Deferred_ProcessWork
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Executes all the queued work items, called by the PendSV handler (Os_Port.asm)
+*              before the context switch so the work can make tasks ready.
+************************************************************************************/
+void Deferred_ProcessWork(void);
+
+#endif /* DEFERRED_H_ */
@@ -0,0 +1,150 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Delay.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the DWT cycle counter delays and time measurement         *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Delay.h"
+#include "Clock.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Cycles spent by Delay_Cycles outside of the wait loop, measured by Delay_Init */
+static uint32 g_Delay_CallOverhead = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Wait a_Count units of a_CyclesPerUnit cycles from a_Start ... the target is absolute so the
+ * loop overhead does not accumulate, and each step is far below the 2^31 cycles limit */
+static void Delay_Units(uint32 a_Start, uint32 a_Count, uint32 a_CyclesPerUnit)
+{
+    uint32 Target = a_Start;
+
+    while(a_Count != 0)
+    {
+        Target += a_CyclesPerUnit;
+        while((sint32)(DWT_CYCCNT_REG - Target) < 0);
+        a_Count--;
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Delay_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enable the DWT cycle counter and measure the call overhead of Delay_Cycles,
+ *              the overhead is removed from every delay so it does not depend on the optimization level.
+ ************************************************************************************/
+void Delay_Init(void)
+{
+    uint32 Start;
+
+    /* The DWT unit is enabled by the trace enable bit of the debug monitor control register */
+    DEBUG_DEMCR_REG |= DEMCR_TRCENA_BIT_MASK;
+    DWT_CYCCNT_REG = 0;
+    DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA_BIT_MASK;
+
+    g_Delay_CallOverhead = 0;
+    Start = DWT_CYCCNT_REG;
+    Delay_Cycles(0);
+    g_Delay_CallOverhead = DWT_CYCCNT_REG - Start;
+}
+
+
+/************************************************************************************
+ * Service Name: Delay_GetCycles
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Current value of the free running cycle counter
+ * Description: Function to take a timestamp in core clock cycles, it wraps every 2^32 cycles.
+ ************************************************************************************/
+uint32 Delay_GetCycles(void)
+{
+    return DWT_CYCCNT_REG;
+}
+
+
+/************************************************************************************
+ * Service Name: Delay_GetElapsedCycles
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_StartCycles - Timestamp returned by Delay_GetCycles
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Cycles elapsed since the timestamp
+ * Description: Function to measure the cycles elapsed since a timestamp, correct across one wrap
+ *              of the counter.
+ ************************************************************************************/
+uint32 Delay_GetElapsedCycles(uint32 a_StartCycles)
+{
+    return DWT_CYCCNT_REG - a_StartCycles;
+}
+
+
+/************************************************************************************
+ * Service Name: Delay_Cycles
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Cycles - Number of core clock cycles, less than 2^31
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to busy-wait the specified number of cycles including the call itself.
+ ************************************************************************************/
+void Delay_Cycles(uint32 a_Cycles)
+{
+    uint32 Target = DWT_CYCCNT_REG;
+
+    if(a_Cycles > g_Delay_CallOverhead)
+    {
+        Target += a_Cycles - g_Delay_CallOverhead;
+        while((sint32)(DWT_CYCCNT_REG - Target) < 0);
+    }
+}
+
+
+/************************************************************************************
+ * Service Name: Delay_US
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_MicroSeconds - Time in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to busy-wait the specified time in micro-seconds.
+ ************************************************************************************/
+void Delay_US(uint32 a_MicroSeconds)
+{
+    Delay_Units(DWT_CYCCNT_REG, a_MicroSeconds, Clock_GetSystemClock() / 1000000);
+}
+
+
+/************************************************************************************
+ * Service Name: Delay_MS
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_MilliSeconds - Time in milli-seconds
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to busy-wait the specified time in milli-seconds.
+ ************************************************************************************/
+void Delay_MS(uint32 a_MilliSeconds)
+{
+    Delay_Units(DWT_CYCCNT_REG, a_MilliSeconds, Clock_GetSystemClock() / 1000);
+}
@@ -0,0 +1,101 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Delay.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the DWT cycle counter delays and time measurement         *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef DELAY_H_
+#define DELAY_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define DEMCR_TRCENA_BIT_MASK         0x01000000
+#define DWT_CTRL_CYCCNTENA_BIT_MASK   0x00000001
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Delay_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enable the DWT cycle counter and measure the call overhead of Delay_Cycles,
+*              the overhead is removed from every delay so it does not depend on the optimization level.
+************************************************************************************/
+void Delay_Init(void);
+
+
+/************************************************************************************
+* Service Name: Delay_GetCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the free running cycle counter
+* Description: Function to take a timestamp in core clock cycles, it wraps every 2^32 cycles.
+************************************************************************************/
+uint32 Delay_GetCycles(void);
+
+
+/************************************************************************************
+* Service Name: Delay_GetElapsedCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_StartCycles - Timestamp returned by Delay_GetCycles
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Cycles elapsed since the timestamp
+* Description: Function to measure the cycles elapsed since a timestamp, correct across one wrap
+*              of the counter.
+************************************************************************************/
+uint32 Delay_GetElapsedCycles(uint32 a_StartCycles);
+
+
+/************************************************************************************
+* Service Name: Delay_Cycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Cycles - Number of core clock cycles, less than 2^31
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait the specified number of cycles including the call itself.
+************************************************************************************/
+void Delay_Cycles(uint32 a_Cycles);
+
+
+/************************************************************************************
+* Service Name: Delay_US
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_MicroSeconds - Time in micro-seconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait the specified time in micro-seconds.
+************************************************************************************/
+void Delay_US(uint32 a_MicroSeconds);
+
+
+/************************************************************************************
+* Service Name: Delay_MS
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_MilliSeconds - Time in milli-seconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait the specified time in milli-seconds.
+************************************************************************************/
+void Delay_MS(uint32 a_MilliSeconds);
+
+#endif /* DELAY_H_ */
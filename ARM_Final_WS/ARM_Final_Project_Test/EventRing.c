@@ -0,0 +1,195 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           EventRing.c                                                               *
+ * [DESCRIPTION]    :           Source file for the lock-free single-producer/single-consumer ring buffer *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include <string.h>
+#include "EventRing.h"
+#include "NVIC.h"
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Copy a_Count elements to the ring starting at the free running index a_Index, wrapping at the end */
+static void EventRing_CopyIn(EventRing_Type *a_Ring, uint32 a_Index, const uint8 *a_Elements, uint32 a_Count)
+{
+    uint32 Offset = a_Index & a_Ring->Mask;
+    uint32 First_Part = (a_Ring->Mask + 1) - Offset;
+
+    if(First_Part > a_Count)
+    {
+        First_Part = a_Count;
+    }
+
+    memcpy(&a_Ring->Buffer[Offset * a_Ring->ElementSize], a_Elements, First_Part * a_Ring->ElementSize);
+    memcpy(a_Ring->Buffer, &a_Elements[First_Part * a_Ring->ElementSize], (a_Count - First_Part) * a_Ring->ElementSize);
+}
+
+/* Copy a_Count elements out of the ring starting at the free running index a_Index, wrapping at the end */
+static void EventRing_CopyOut(const EventRing_Type *a_Ring, uint32 a_Index, uint8 *a_Elements, uint32 a_Count)
+{
+    uint32 Offset = a_Index & a_Ring->Mask;
+    uint32 First_Part = (a_Ring->Mask + 1) - Offset;
+
+    if(First_Part > a_Count)
+    {
+        First_Part = a_Count;
+    }
+
+    memcpy(a_Elements, &a_Ring->Buffer[Offset * a_Ring->ElementSize], First_Part * a_Ring->ElementSize);
+    memcpy(&a_Elements[First_Part * a_Ring->ElementSize], a_Ring->Buffer, (a_Count - First_Part) * a_Ring->ElementSize);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: EventRing_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Buffer - Storage of (a_Capacity * a_ElementSize) bytes
+ *                , a_ElementSize - Size of one element in bytes
+ *                , a_Capacity - Number of elements, must be a power of 2
+ * Parameters (inout): a_Ring - Ring object
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the capacity is not a power of 2
+ * Description: Initialize an empty ring on the given storage.
+ ************************************************************************************/
+boolean EventRing_Init(EventRing_Type *a_Ring, void *a_Buffer, uint32 a_ElementSize, uint32 a_Capacity)
+{
+    /* The free running indexes are masked, so the capacity must be a power of 2 */
+    if((a_Capacity == 0) || ((a_Capacity & (a_Capacity - 1)) != 0))
+    {
+        return FALSE;
+    }
+
+    a_Ring->Buffer = (uint8 *)a_Buffer;
+    a_Ring->ElementSize = a_ElementSize;
+    a_Ring->Mask = a_Capacity - 1;
+    a_Ring->Head = 0;
+    a_Ring->Tail = 0;
+    a_Ring->DroppedCount = 0;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: EventRing_Push
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant (one producer per ring)
+ * Parameters (in): a_Element - Element to be copied to the ring
+ * Parameters (inout): a_Ring - Ring object
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the ring is full (the element is dropped and counted)
+ * Description: Producer side ... copy one element to the ring.
+ ************************************************************************************/
+boolean EventRing_Push(EventRing_Type *a_Ring, const void *a_Element)
+{
+    return (EventRing_PushBatch(a_Ring, a_Element, 1) == 1) ? TRUE : FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: EventRing_PushBatch
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant (one producer per ring)
+ * Parameters (in): a_Elements - Array of elements to be copied to the ring
+ *                , a_Count - Number of elements in the array
+ * Parameters (inout): a_Ring - Ring object
+ * Parameters (out): None
+ * Return value: uint32 - Number of elements copied, the rest are dropped and counted
+ * Description: Producer side ... copy several elements to the ring and publish them at once.
+ ************************************************************************************/
+uint32 EventRing_PushBatch(EventRing_Type *a_Ring, const void *a_Elements, uint32 a_Count)
+{
+    uint32 Head = a_Ring->Head;
+    uint32 Free = (a_Ring->Mask + 1) - (Head - a_Ring->Tail);
+
+    if(a_Count > Free)
+    {
+        a_Ring->DroppedCount += a_Count - Free;
+        a_Count = Free;
+    }
+
+    if(a_Count != 0)
+    {
+        EventRing_CopyIn(a_Ring, Head, (const uint8 *)a_Elements, a_Count);
+
+        /* The elements must be in memory before the consumer can see the new head */
+        Data_Memory_Barrier();
+        a_Ring->Head = Head + a_Count;
+    }
+
+    return a_Count;
+}
+
+
+/************************************************************************************
+ * Service Name: EventRing_Pop
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant (one consumer per ring)
+ * Parameters (in): None
+ * Parameters (inout): a_Ring - Ring object
+ * Parameters (out): a_Element - The oldest element of the ring
+ * Return value: boolean - FALSE if the ring is empty
+ * Description: Consumer side ... copy out and remove the oldest element.
+ ************************************************************************************/
+boolean EventRing_Pop(EventRing_Type *a_Ring, void *a_Element)
+{
+    return (EventRing_PopBatch(a_Ring, a_Element, 1) == 1) ? TRUE : FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: EventRing_PopBatch
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant (one consumer per ring)
+ * Parameters (in): a_MaxCount - Size of the output array in elements
+ * Parameters (inout): a_Ring - Ring object
+ * Parameters (out): a_Elements - The oldest elements of the ring
+ * Return value: uint32 - Number of elements copied out
+ * Description: Consumer side ... copy out and remove up to a_MaxCount elements at once.
+ ************************************************************************************/
+uint32 EventRing_PopBatch(EventRing_Type *a_Ring, void *a_Elements, uint32 a_MaxCount)
+{
+    uint32 Tail = a_Ring->Tail;
+    uint32 Count = a_Ring->Head - Tail;
+
+    if(Count > a_MaxCount)
+    {
+        Count = a_MaxCount;
+    }
+
+    if(Count != 0)
+    {
+        /* Read the elements only after the head that published them */
+        Data_Memory_Barrier();
+        EventRing_CopyOut(a_Ring, Tail, (uint8 *)a_Elements, Count);
+
+        /* The elements must be copied out before the producer can overwrite them */
+        Data_Memory_Barrier();
+        a_Ring->Tail = Tail + Count;
+    }
+
+    return Count;
+}
+
+
+/************************************************************************************
+ * Service Name: EventRing_GetCount
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Ring - Ring object
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of elements waiting in the ring
+ * Description: Function to get the number of elements waiting in the ring.
+ ************************************************************************************/
+uint32 EventRing_GetCount(const EventRing_Type *a_Ring)
+{
+    return a_Ring->Head - a_Ring->Tail;
+}
@@ -0,0 +1,112 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           EventRing.h                                                               *
+ * [DESCRIPTION]    :           Header file for the lock-free single-producer/single-consumer ring buffer *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef EVENTRING_H_
+#define EVENTRING_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Ring object ... exactly one producer (e.g. an ISR) and one consumer (e.g. main) per ring.
+ * Head and Tail are free running counters, each one is written by one side only so no
+ * interrupt masking is needed */
+typedef struct
+{
+    uint8          *Buffer;
+    uint32          ElementSize;
+    uint32          Mask;             /* Capacity - 1, the capacity is a power of 2 */
+    volatile uint32 Head;             /* Written by the producer only */
+    volatile uint32 Tail;             /* Written by the consumer only */
+    volatile uint32 DroppedCount;     /* Written by the producer only */
+}EventRing_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: EventRing_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Buffer - Storage of (a_Capacity * a_ElementSize) bytes
+*                , a_ElementSize - Size of one element in bytes
+*                , a_Capacity - Number of elements, must be a power of 2
+* Parameters (inout): a_Ring - Ring object
+* Parameters (out): None
+* Return value: boolean - FALSE if the capacity is not a power of 2
+* Description: Initialize an empty ring on the given storage.
+************************************************************************************/
+boolean EventRing_Init(EventRing_Type *a_Ring, void *a_Buffer, uint32 a_ElementSize, uint32 a_Capacity);
+
+
+/************************************************************************************
+* Service Name: EventRing_Push
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant (one producer per ring)
+* Parameters (in): a_Element - Element to be copied to the ring
+* Parameters (inout): a_Ring - Ring object
+* Parameters (out): None
+* Return value: boolean - FALSE if the ring is full (the element is dropped and counted)
+* Description: Producer side ... copy one element to the ring.
+************************************************************************************/
+boolean EventRing_Push(EventRing_Type *a_Ring, const void *a_Element);
+
+
+/************************************************************************************
+* Service Name: EventRing_PushBatch
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant (one producer per ring)
+* Parameters (in): a_Elements - Array of elements to be copied to the ring
+*                , a_Count - Number of elements in the array
+* Parameters (inout): a_Ring - Ring object
+* Parameters (out): None
+* Return value: uint32 - Number of elements copied, the rest are dropped and counted
+* Description: Producer side ... copy several elements to the ring and publish them at once.
+************************************************************************************/
+uint32 EventRing_PushBatch(EventRing_Type *a_Ring, const void *a_Elements, uint32 a_Count);
+
+
+/************************************************************************************
+* Service Name: EventRing_Pop
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant (one consumer per ring)
+* Parameters (in): None
+* Parameters (inout): a_Ring - Ring object
+* Parameters (out): a_Element - The oldest element of the ring
+* Return value: boolean - FALSE if the ring is empty
+* Description: Consumer side ... copy out and remove the oldest element.
+************************************************************************************/
+boolean EventRing_Pop(EventRing_Type *a_Ring, void *a_Element);
+
+
+/************************************************************************************
+* Service Name: EventRing_PopBatch
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant (one consumer per ring)
+* Parameters (in): a_MaxCount - Size of the output array in elements
+* Parameters (inout): a_Ring - Ring object
+* Parameters (out): a_Elements - The oldest elements of the ring
+* Return value: uint32 - Number of elements copied out
+* Description: Consumer side ... copy out and remove up to a_MaxCount elements at once.
+************************************************************************************/
+uint32 EventRing_PopBatch(EventRing_Type *a_Ring, void *a_Elements, uint32 a_MaxCount);
+
+
+/************************************************************************************
+* Service Name: EventRing_GetCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Ring - Ring object
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of elements waiting in the ring
+* Description: Function to get the number of elements waiting in the ring.
+************************************************************************************/
+uint32 EventRing_GetCount(const EventRing_Type *a_Ring);
+
+#endif /* EVENTRING_H_ */
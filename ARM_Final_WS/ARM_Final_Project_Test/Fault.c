@@ -0,0 +1,234 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Fault.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the post-mortem fault capture - record kept over reset    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Fault.h"
+#include "NVIC.h"
+#include "Log.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Only these ranges are read by the capture, a bus fault inside the fault handler would lock up */
+#define FAULT_SRAM_START              0x20000000
+#define FAULT_SRAM_END                0x20008000
+#define FAULT_FLASH_END               0x00040000
+
+#define FAULT_VECTACTIVE_MASK         0x000000FF
+
+/* EXC_RETURN bit 4 is clear when the FPU registers were stacked too (extended frame) */
+#define FAULT_EXC_RETURN_BASIC_FRAME  0x00000010
+#define FAULT_EXTENDED_FRAME_WORDS    26
+
+/* xPSR bit 9 is set when a padding word was stacked to align the frame on 8 bytes */
+#define FAULT_XPSR_STACK_ALIGN        0x00000200
+
+#define FAULT_DIV_0_TRAP_MASK         0x00000010
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+#pragma DATA_SECTION(g_Fault_Record, FAULT_RECORD_SECTION)
+static Fault_RecordType g_Fault_Record;
+
+#ifndef HOST_SIMULATION
+/* Address of MPU_CTRL for Fault_Port.asm, the assembler can't expand the registers macros */
+const uint32 g_Fault_MpuCtrlAddress = (uint32)&MPU_CTRL_REG;
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/* Called only from Fault_Handler (Fault_Port.asm) with the stack pointer that holds the exception
+ * frame and EXC_RETURN, runs on the main stack at the fault priority and never returns */
+void Fault_Capture(const uint32 *a_Frame, uint32 a_ExcReturn);
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static boolean Fault_IsReadable(uint32 a_Address, uint32 a_Words)
+{
+    return ((a_Address & 0x3) == 0) && (a_Address >= FAULT_SRAM_START) &&
+           (a_Address <= (FAULT_SRAM_END - (a_Words * 4)));
+}
+
+static uint32 Fault_Checksum(const Fault_RecordType *a_Record)
+{
+    const uint32 *Word = (const uint32 *)a_Record;
+    uint32 Sum = 0;
+    uint32 Index;
+
+    for(Index = 0; Index < ((sizeof(Fault_RecordType) / 4) - 1); Index++)
+    {
+        Sum += Word[Index];
+    }
+    return ~Sum;
+}
+
+void Fault_Capture(const uint32 *a_Frame, uint32 a_ExcReturn)
+{
+    Fault_RecordType *Record = &g_Fault_Record;
+    uint32 Address = (uint32)a_Frame;
+    uint32 Stack_End;
+    uint32 Word;
+    uint32 Index;
+
+    Record->Vector = NVIC_SYSTEM_INTCTRL & FAULT_VECTACTIVE_MASK;
+    Record->ExcReturn = a_ExcReturn;
+    Record->Cfsr = NVIC_SYSTEM_FAULTSTAT;
+    Record->Hfsr = NVIC_SYSTEM_HFAULTSTAT;
+    Record->Mmfar = NVIC_SYSTEM_MMADDR;
+    Record->Bfar = NVIC_SYSTEM_FAULTADDR;
+    Record->StackPointer = Address;
+    Record->BacktraceCount = 0;
+
+    /* The frame is not readable if the fault happened while stacking it (stack overflow) */
+    if(Fault_IsReadable(Address, FAULT_FRAME_WORDS) == TRUE)
+    {
+        for(Index = 0; Index < FAULT_FRAME_WORDS; Index++)
+        {
+            Record->Frame[Index] = a_Frame[Index];
+        }
+
+        /* SP of the faulting code ... above the frame and its padding word */
+        Address += ((a_ExcReturn & FAULT_EXC_RETURN_BASIC_FRAME) ? FAULT_FRAME_WORDS : FAULT_EXTENDED_FRAME_WORDS) * 4;
+        if(Record->Frame[FAULT_FRAME_XPSR] & FAULT_XPSR_STACK_ALIGN)
+        {
+            Address += 4;
+        }
+        Record->StackPointer = Address;
+
+        /* Backtrace ... the Thumb code addresses (bit 0 set) pushed on the stack are return addresses
+         * of the callers or stale values, the stacked LR is the first one */
+        Stack_End = Address + (FAULT_BACKTRACE_SEARCH_WORDS * 4);
+        if(Stack_End > FAULT_SRAM_END)
+        {
+            Stack_End = FAULT_SRAM_END;
+        }
+        for(; (Address < Stack_End) && (Record->BacktraceCount < FAULT_BACKTRACE_DEPTH); Address += 4)
+        {
+            Word = *(const uint32 *)Address;
+            if((Word & 0x1) && (Word < FAULT_FLASH_END))
+            {
+                Record->Backtrace[Record->BacktraceCount++] = Word & ~0x1UL;
+            }
+        }
+    }
+    else
+    {
+        for(Index = 0; Index < FAULT_FRAME_WORDS; Index++)
+        {
+            Record->Frame[Index] = 0;
+        }
+    }
+
+    Record->Magic = FAULT_RECORD_MAGIC;
+    Record->Checksum = Fault_Checksum(Record);
+
+    /* The record is in SRAM before the reset is requested, the reset keeps the SRAM content */
+    Data_Sync_Barrier();
+    NVIC_SYSTEM_APINT = NVIC_APINT_VECTKEY | NVIC_APINT_SYSRESREQ;
+    Data_Sync_Barrier();
+
+    /* Wait for the reset */
+    while(1)
+    {
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Fault_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enable the MemManage, Bus and Usage fault exceptions (a disabled one escalates to a
+ *              Hard fault) and the divide by zero trap, all are captured by Fault_Handler.
+ ************************************************************************************/
+void Fault_Init(void)
+{
+    NVIC_SYSTEM_CFGCTRL |= FAULT_DIV_0_TRAP_MASK;
+
+    NVIC_EnableException(EXCEPTION_MEM_FAULT_TYPE);
+    NVIC_EnableException(EXCEPTION_BUS_FAULT_TYPE);
+    NVIC_EnableException(EXCEPTION_USAGE_FAULT_TYPE);
+}
+
+
+/* The target version is in Fault_Port.asm, it disables the MPU and passes the frame to
+ * Fault_Capture without using the stack. The faults are not modelled by the simulation */
+#ifdef HOST_SIMULATION
+void Fault_Handler(void)
+{
+    while(1)
+    {
+    }
+}
+#endif
+
+
+/************************************************************************************
+ * Service Name: Fault_GetRecord
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): a_Record - Copy of the record of the last fault
+ * Return value: boolean - TRUE if a fault was captured before the last reset
+ * Description: Function to get the record kept over the reset.
+ ************************************************************************************/
+boolean Fault_GetRecord(Fault_RecordType *a_Record)
+{
+    /* The SRAM content is random after a power-on */
+    if((g_Fault_Record.Magic != FAULT_RECORD_MAGIC) || (g_Fault_Record.Checksum != Fault_Checksum(&g_Fault_Record)))
+    {
+        return FALSE;
+    }
+
+    *a_Record = g_Fault_Record;
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Fault_Report
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to log the record of the fault captured before the last reset, if any, then
+ *              clear it so it is reported once. Must be called after Log_Init.
+ ************************************************************************************/
+void Fault_Report(void)
+{
+    Fault_RecordType Record;
+    uint32 Index;
+
+    if(Fault_GetRecord(&Record) == FALSE)
+    {
+        return;
+    }
+    g_Fault_Record.Magic = 0;
+
+    LOG4("Fault: vector %u, CFSR 0x%08X, HFSR 0x%08X, SP 0x%08X", Record.Vector, Record.Cfsr, Record.Hfsr, Record.StackPointer);
+    LOG4("Fault: PC 0x%08X, LR 0x%08X, xPSR 0x%08X, EXC_RETURN 0x%08X", Record.Frame[FAULT_FRAME_PC],
+         Record.Frame[FAULT_FRAME_LR], Record.Frame[FAULT_FRAME_XPSR], Record.ExcReturn);
+    LOG4("Fault: R0 0x%08X, R1 0x%08X, R2 0x%08X, R3 0x%08X", Record.Frame[0], Record.Frame[1], Record.Frame[2], Record.Frame[3]);
+    LOG3("Fault: R12 0x%08X, MMFAR 0x%08X, BFAR 0x%08X", Record.Frame[4], Record.Mmfar, Record.Bfar);
+    for(Index = 0; Index < Record.BacktraceCount; Index++)
+    {
+        LOG2("Fault: backtrace %u 0x%08X", Index, Record.Backtrace[Index]);
+    }
+}
@@ -0,0 +1,109 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Fault.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the post-mortem fault capture - record kept over reset    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef FAULT_H_
+#define FAULT_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* The record is placed in a section not initialized by the C start-up (tm4c123gh6pm.cmd),
+ * its content survives the system reset requested by the fault handler */
+#define FAULT_RECORD_SECTION          ".noinit"
+#define FAULT_RECORD_MAGIC            0xFA017EC0
+
+/* Code addresses found on the stack above the exception frame */
+#define FAULT_BACKTRACE_DEPTH         8
+
+/* Words of the stack searched for the backtrace */
+#define FAULT_BACKTRACE_SEARCH_WORDS  128
+
+/* Words of the exception frame: R0, R1, R2, R3, R12, LR, PC and xPSR */
+#define FAULT_FRAME_WORDS             8
+#define FAULT_FRAME_LR                5
+#define FAULT_FRAME_PC                6
+#define FAULT_FRAME_XPSR              7
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 Magic;                                   /* FAULT_RECORD_MAGIC when the record is valid */
+    uint32 Vector;                                  /* 3 Hard, 4 MemManage, 5 Bus or 6 Usage fault */
+    uint32 Frame[FAULT_FRAME_WORDS];                /* Stacked registers, 0 if the frame is not readable */
+    uint32 ExcReturn;                               /* LR at the handler entry */
+    uint32 StackPointer;                            /* SP of the faulting code before the stacking */
+    uint32 Cfsr;                                    /* Configurable Fault Status (MemManage, Bus, Usage) */
+    uint32 Hfsr;                                    /* Hard Fault Status */
+    uint32 Mmfar;                                   /* MemManage Fault Address */
+    uint32 Bfar;                                    /* Bus Fault Address */
+    uint32 BacktraceCount;
+    uint32 Backtrace[FAULT_BACKTRACE_DEPTH];        /* Return addresses, the most recent first */
+    uint32 Checksum;                                /* Sum of the words above, detects a random SRAM content */
+}Fault_RecordType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Fault_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enable the MemManage, Bus and Usage fault exceptions (a disabled one escalates to a
+*              Hard fault) and the divide by zero trap, all are captured by Fault_Handler.
+************************************************************************************/
+void Fault_Init(void);
+
+
+/************************************************************************************
+* Service Name: Fault_Handler
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler for the Hard, MemManage, Bus and Usage faults in the vector table. Captures
+*              the fault in the record then requests a system reset, it never returns.
+************************************************************************************/
+void Fault_Handler(void);
+
+
+/************************************************************************************
+* Service Name: Fault_GetRecord
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): a_Record - Copy of the record of the last fault
+* Return value: boolean - TRUE if a fault was captured before the last reset
+* Description: Function to get the record kept over the reset.
+************************************************************************************/
+boolean Fault_GetRecord(Fault_RecordType *a_Record);
+
+
+/************************************************************************************
+* Service Name: Fault_Report
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to log the record of the fault captured before the last reset, if any, then
+*              clear it so it is reported once. Must be called after Log_Init.
+************************************************************************************/
+void Fault_Report(void);
+
+#endif /* FAULT_H_ */
@@ -0,0 +1,46 @@
+;**********************************************************************************************************
+; [FILE NAME]      :           Fault_Port.asm                                                             *
+; [DESCRIPTION]    :           Fault handler entry of the post-mortem capture                             *
+; [DATE CREATED]   :           OCT 17, 2026                                                               *
+; [AURTHOR]        :           Alaa Mekawi                                                                *
+;**********************************************************************************************************
+        .thumb
+        .text
+
+        .global Fault_Handler
+        .global Fault_Capture
+        .global g_Fault_MpuCtrlAddress
+
+;************************************************************************************
+; Service Name: Fault_Handler
+; Sync/Async: Asynchronous
+; Reentrancy: Non-reentrant
+; Parameters (in): None
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: None
+; Description: Handler for the Hard, MemManage, Bus and Usage faults in the vector table. The MPU
+;              is disabled first (MPU_CTRL), Fault_Capture can then run on a main stack that
+;              overflowed into its guard region. EXC_RETURN bit 2 selects the stack holding the
+;              frame (MSP or the PSP of a task), the frame pointer and EXC_RETURN are passed in R0
+;              and R1. Nothing is pushed before, it never returns.
+;************************************************************************************
+Fault_Handler: .asmfunc
+        LDR     R2, FaultMpuCtrlAddr
+        LDR     R2, [R2]
+        MOVS    R3, #0
+        STR     R3, [R2]
+        DSB
+        ISB
+        TST     LR, #4
+        ITE     EQ
+        MRSEQ   R0, MSP
+        MRSNE   R0, PSP
+        MOV     R1, LR
+        B.W     Fault_Capture
+        .endasmfunc
+
+        .align  4
+FaultMpuCtrlAddr:   .word   g_Fault_MpuCtrlAddress
+
+        .end
@@ -0,0 +1,392 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Gpio.c                                                                    *
+ * [DESCRIPTION]    :           Source file for the GPIO driver of PORTA .. PORTF - masked DATA accesses  *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Gpio.h"
+#include "NVIC.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* PCTL holds 4 bits per pin, 0 selects the GPIO function */
+#define GPIO_PCTL_PIN_MASK            0xF
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Registers of a port merged from a pins configuration table, only the bits of Pins are written */
+typedef struct
+{
+    Gpio_PinsType Pins;         /* Pins of the port in the table */
+    Gpio_PinsType Outputs;
+    uint8  Data;
+    uint8  Dir;
+    uint8  Afsel;
+    uint8  Pur;
+    uint8  Pdr;
+    uint8  Den;
+    uint8  Amsel;
+    uint8  Ibe;
+    uint8  Iev;
+    uint8  Im;
+    uint32 Pctl;
+    uint32 PctlMask;
+}Gpio_PortImageType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Pins with their CR bit cleared out of reset, PC0 .. PC3 (JTAG), PD7 and PF0 (NMI) */
+static const Gpio_PinsType g_Gpio_LockedPins[GPIO_PORTS_COUNT] = {0x00, 0x00, 0x0F, 0x80, 0x00, 0x01};
+
+/* All the ports are on the APB out of reset */
+uint32 g_Gpio_PortBase[GPIO_PORTS_COUNT] =
+{
+    GPIO_PORT_APB_BASE(GPIO_PORT_A), GPIO_PORT_APB_BASE(GPIO_PORT_B), GPIO_PORT_APB_BASE(GPIO_PORT_C),
+    GPIO_PORT_APB_BASE(GPIO_PORT_D), GPIO_PORT_APB_BASE(GPIO_PORT_E), GPIO_PORT_APB_BASE(GPIO_PORT_F)
+};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Set the bits of a_Pins in a configuration register to a_Value (read-modify-write) */
+static void Gpio_UpdateRegister(uint32 a_Base, uint32 a_Offset, Gpio_PinsType a_Pins, uint8 a_Value)
+{
+    GPIO_PORT_REG(a_Base, a_Offset) = (GPIO_PORT_REG(a_Base, a_Offset) & ~(uint32)a_Pins) | (a_Value & a_Pins);
+}
+
+/* GPIO function, no analog and digital enabled ... must be called inside a critical section */
+static void Gpio_SelectDigital(uint32 a_Base, Gpio_PinsType a_Pins)
+{
+    uint32 Pctl_Mask = 0;
+    uint8 Pin;
+
+    for(Pin = 0; Pin < 8; Pin++)
+    {
+        if(a_Pins & (1 << Pin))
+        {
+            Pctl_Mask |= (uint32)GPIO_PCTL_PIN_MASK << (Pin * 4);
+        }
+    }
+
+    /* The commit register only protects the locked pins, the bits of the other pins stay set */
+    GPIO_PORT_REG(a_Base, GPIO_LOCK_OFFSET) = GPIO_LOCK_KEY;
+    GPIO_PORT_REG(a_Base, GPIO_CR_OFFSET) |= a_Pins;
+    GPIO_PORT_REG(a_Base, GPIO_LOCK_OFFSET) = 0;
+
+    Gpio_UpdateRegister(a_Base, GPIO_AMSEL_OFFSET, a_Pins, 0);
+    GPIO_PORT_REG(a_Base, GPIO_PCTL_OFFSET) &= ~Pctl_Mask;
+    Gpio_UpdateRegister(a_Base, GPIO_AFSEL_OFFSET, a_Pins, 0);
+    Gpio_UpdateRegister(a_Base, GPIO_DEN_OFFSET, a_Pins, GPIO_PINS_ALL);
+}
+
+/* Set or clear the bits of a_Pins in a register image */
+static uint8 Gpio_SelectPins(uint8 a_Register, Gpio_PinsType a_Pins, boolean a_Set)
+{
+    return (uint8)((a_Register & ~a_Pins) | ((a_Set == TRUE) ? a_Pins : 0));
+}
+
+/* Merge an entry of a pins configuration table into the image of its port */
+static void Gpio_MergeEntry(Gpio_PortImageType *a_Image, const Gpio_PinConfigType *a_Entry)
+{
+    Gpio_PinsType Pins = a_Entry->Pins;
+    Gpio_ModeType Mode = a_Entry->Mode;
+    uint32 Pin_Mask;
+    uint8 Pin;
+
+    a_Image->Pins |= Pins;
+    a_Image->Outputs = Gpio_SelectPins(a_Image->Outputs, Pins, (boolean)(Mode == GPIO_MODE_OUTPUT));
+    a_Image->Data = (uint8)((a_Image->Data & ~Pins) | (a_Entry->Level & Pins));
+    a_Image->Dir = Gpio_SelectPins(a_Image->Dir, Pins, (boolean)(Mode == GPIO_MODE_OUTPUT));
+    a_Image->Afsel = Gpio_SelectPins(a_Image->Afsel, Pins, (boolean)((Mode == GPIO_MODE_ALTERNATE) || (Mode == GPIO_MODE_ANALOG)));
+    a_Image->Den = Gpio_SelectPins(a_Image->Den, Pins, (boolean)(Mode != GPIO_MODE_ANALOG));
+    a_Image->Amsel = Gpio_SelectPins(a_Image->Amsel, Pins, (boolean)(Mode == GPIO_MODE_ANALOG));
+    a_Image->Pur = Gpio_SelectPins(a_Image->Pur, Pins, (boolean)(a_Entry->Pull == GPIO_PULL_UP));
+    a_Image->Pdr = Gpio_SelectPins(a_Image->Pdr, Pins, (boolean)(a_Entry->Pull == GPIO_PULL_DOWN));
+
+    /* Only the inputs interrupt */
+    a_Image->Im = Gpio_SelectPins(a_Image->Im, Pins, (boolean)((Mode == GPIO_MODE_INPUT) && (a_Entry->Edge != GPIO_EDGE_NONE)));
+    a_Image->Ibe = Gpio_SelectPins(a_Image->Ibe, Pins, (boolean)(a_Entry->Edge == GPIO_EDGE_BOTH));
+    a_Image->Iev = Gpio_SelectPins(a_Image->Iev, Pins, (boolean)(a_Entry->Edge == GPIO_EDGE_RISING));
+
+    for(Pin = 0; Pin < 8; Pin++)
+    {
+        if(Pins & (1 << Pin))
+        {
+            Pin_Mask = (uint32)GPIO_PCTL_PIN_MASK << (Pin * 4);
+            a_Image->PctlMask |= Pin_Mask;
+            a_Image->Pctl = (a_Image->Pctl & ~Pin_Mask) | (((uint32)a_Entry->Function << (Pin * 4)) & Pin_Mask);
+        }
+    }
+}
+
+/* Write the bits of a_Mask in a register ... a register fully covered is written without being read,
+ * otherwise it is read and written only if one of the bits changes */
+static void Gpio_WriteRegister(uint32 a_Base, uint32 a_Offset, uint32 a_Mask, uint32 a_FullMask, uint32 a_Value)
+{
+    uint32 Current;
+
+    if(a_Mask == a_FullMask)
+    {
+        GPIO_PORT_REG(a_Base, a_Offset) = a_Value;
+    }
+    else
+    {
+        Current = GPIO_PORT_REG(a_Base, a_Offset);
+        if(((Current ^ a_Value) & a_Mask) != 0)
+        {
+            GPIO_PORT_REG(a_Base, a_Offset) = (Current & ~a_Mask) | (a_Value & a_Mask);
+        }
+    }
+}
+
+/* Write the image of a port ... must be called inside a critical section */
+static void Gpio_WriteImage(Gpio_PortType a_Port, const Gpio_PortImageType *a_Image)
+{
+    uint32 Base = g_Gpio_PortBase[a_Port];
+    Gpio_PinsType Pins = a_Image->Pins;
+    Gpio_PinsType Locked = Pins & g_Gpio_LockedPins[a_Port];
+
+    if(Locked != 0)
+    {
+        GPIO_PORT_REG(Base, GPIO_LOCK_OFFSET) = GPIO_LOCK_KEY;
+        GPIO_PORT_REG(Base, GPIO_CR_OFFSET) |= Locked;
+        GPIO_PORT_REG(Base, GPIO_LOCK_OFFSET) = 0;
+    }
+
+    /* No interrupt while the sense of the pins changes */
+    Gpio_WriteRegister(Base, GPIO_IM_OFFSET, Pins, GPIO_PINS_ALL, 0);
+
+    /* Levels before the direction so the outputs never drive a stale level, the aperture needs no read */
+    if(a_Image->Outputs != 0)
+    {
+        GPIO_DATA_BITS_REG(Base, a_Image->Outputs) = a_Image->Data;
+    }
+    Gpio_WriteRegister(Base, GPIO_PUR_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Pur);
+    Gpio_WriteRegister(Base, GPIO_PDR_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Pdr);
+    Gpio_WriteRegister(Base, GPIO_DIR_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Dir);
+    Gpio_WriteRegister(Base, GPIO_AMSEL_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Amsel);
+    Gpio_WriteRegister(Base, GPIO_PCTL_OFFSET, a_Image->PctlMask, 0xFFFFFFFF, a_Image->Pctl);
+    Gpio_WriteRegister(Base, GPIO_AFSEL_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Afsel);
+    Gpio_WriteRegister(Base, GPIO_DEN_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Den);
+
+    /* Edges, the flags latched while they changed are cleared before the interrupts are unmasked */
+    Gpio_WriteRegister(Base, GPIO_IS_OFFSET, Pins, GPIO_PINS_ALL, 0);
+    Gpio_WriteRegister(Base, GPIO_IBE_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Ibe);
+    Gpio_WriteRegister(Base, GPIO_IEV_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Iev);
+    if(a_Image->Im != 0)
+    {
+        GPIO_PORT_REG(Base, GPIO_ICR_OFFSET) = a_Image->Im;
+        Gpio_WriteRegister(Base, GPIO_IM_OFFSET, Pins, GPIO_PINS_ALL, a_Image->Im);
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Gpio_EnablePort
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port to clock
+ *                , a_Bus - Aperture of the registers of the port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to select the bus of a port, enable its clock and wait until its registers
+ *              are ready. The aperture not selected is not decoded anymore, the port must not be in
+ *              use while it is switched.
+ ************************************************************************************/
+void Gpio_EnablePort(Gpio_PortType a_Port, Gpio_BusType a_Bus)
+{
+    uint32 Primask;
+
+    /* The bus and the base change together so no ISR sees the base of the aperture switched off */
+    Primask = NVIC_DisableExceptionsSave();
+    if(a_Bus == GPIO_BUS_AHB)
+    {
+        SYSCTL_GPIOHBCTL_REG |= (1UL << a_Port);
+        g_Gpio_PortBase[a_Port] = GPIO_PORT_AHB_BASE(a_Port);
+    }
+    else
+    {
+        SYSCTL_GPIOHBCTL_REG &= ~(1UL << a_Port);
+        g_Gpio_PortBase[a_Port] = GPIO_PORT_APB_BASE(a_Port);
+    }
+    SYSCTL_RCGCGPIO_REG |= (1UL << a_Port);
+    NVIC_RestoreExceptions(Primask);
+
+    while(!(SYSCTL_PRGPIO_REG & (1UL << a_Port)));
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_ConfigureOutput
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port of the pins
+ *                , a_Pins - Pins configured as digital outputs, the other pins are not changed
+ *                , a_Value - Initial levels of the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure digital GPIO outputs, the levels are written before the
+ *              direction so the pins never drive a stale level.
+ ************************************************************************************/
+void Gpio_ConfigureOutput(Gpio_PortType a_Port, Gpio_PinsType a_Pins, uint8 a_Value)
+{
+    uint32 Base = g_Gpio_PortBase[a_Port];
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    Gpio_WritePins(a_Port, a_Pins, a_Value);
+    Gpio_UpdateRegister(Base, GPIO_DIR_OFFSET, a_Pins, GPIO_PINS_ALL);
+    Gpio_SelectDigital(Base, a_Pins);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_ConfigureInput
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port of the pins
+ *                , a_Pins - Pins configured as digital inputs, the other pins are not changed
+ *                , a_Pull - Pull resistor of the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure digital GPIO inputs, the locked pins (PF0, PD7) are unlocked.
+ ************************************************************************************/
+void Gpio_ConfigureInput(Gpio_PortType a_Port, Gpio_PinsType a_Pins, Gpio_PullType a_Pull)
+{
+    uint32 Base = g_Gpio_PortBase[a_Port];
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    Gpio_UpdateRegister(Base, GPIO_DIR_OFFSET, a_Pins, 0);
+    Gpio_UpdateRegister(Base, GPIO_PUR_OFFSET, a_Pins, (a_Pull == GPIO_PULL_UP) ? GPIO_PINS_ALL : 0);
+    Gpio_UpdateRegister(Base, GPIO_PDR_OFFSET, a_Pins, (a_Pull == GPIO_PULL_DOWN) ? GPIO_PINS_ALL : 0);
+    Gpio_SelectDigital(Base, a_Pins);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_ConfigureInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port of the pins
+ *                , a_Pins - Input pins detecting the edges
+ *                , a_Edge - Edges detected
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure and enable the edge interrupt of input pins, the flags are
+ *              cleared first and GPIO_EDGE_NONE masks it. The IRQ of the port is enabled in the NVIC
+ *              by the caller.
+ ************************************************************************************/
+void Gpio_ConfigureInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins, Gpio_EdgeType a_Edge)
+{
+    uint32 Base = g_Gpio_PortBase[a_Port];
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    Gpio_UpdateRegister(Base, GPIO_IS_OFFSET, a_Pins, 0);
+    Gpio_UpdateRegister(Base, GPIO_IBE_OFFSET, a_Pins, (a_Edge == GPIO_EDGE_BOTH) ? GPIO_PINS_ALL : 0);
+    Gpio_UpdateRegister(Base, GPIO_IEV_OFFSET, a_Pins, (a_Edge == GPIO_EDGE_RISING) ? GPIO_PINS_ALL : 0);
+    Gpio_ClearInterrupt(a_Port, a_Pins);
+    Gpio_UpdateRegister(Base, GPIO_IM_OFFSET, a_Pins, (a_Edge == GPIO_EDGE_NONE) ? 0 : GPIO_PINS_ALL);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_EnableInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port of the pins
+ *                , a_Pins - Pins of the interrupts unmasked
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to unmask the interrupt of pins configured by Gpio_ConfigureInterrupt, the
+ *              flags latched while they were masked are cleared first.
+ ************************************************************************************/
+void Gpio_EnableInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    Gpio_ClearInterrupt(a_Port, a_Pins);
+    Gpio_UpdateRegister(g_Gpio_PortBase[a_Port], GPIO_IM_OFFSET, a_Pins, GPIO_PINS_ALL);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_DisableInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Port - Port of the pins
+ *                , a_Pins - Pins of the interrupts masked
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to mask the interrupt of pins, their edges are still latched in RIS.
+ ************************************************************************************/
+void Gpio_DisableInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+    Gpio_UpdateRegister(g_Gpio_PortBase[a_Port], GPIO_IM_OFFSET, a_Pins, 0);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Gpio_ConfigurePins
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Table - Pins configuration table, the pins not in it are not changed
+ *                , a_Count - Number of entries of the table
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure the pins of a whole board at once. The entries of each port are
+ *              merged into one value per register, a register is written once and only if its value
+ *              changes, and without being read when the table covers all the pins of the port.
+ *              The ports are enabled by Gpio_EnablePort first.
+ ************************************************************************************/
+void Gpio_ConfigurePins(const Gpio_PinConfigType *a_Table, uint8 a_Count)
+{
+    Gpio_PortType Port;
+    uint32 Primask;
+    uint8 Index;
+
+    for(Port = GPIO_PORT_A; Port <= GPIO_PORT_F; Port++)
+    {
+        Gpio_PortImageType Image = {0};
+
+        /* A later entry overrides the pins of an earlier one */
+        for(Index = 0; Index < a_Count; Index++)
+        {
+            if(a_Table[Index].Port == Port)
+            {
+                Gpio_MergeEntry(&Image, &a_Table[Index]);
+            }
+        }
+
+        if(Image.Pins != 0)
+        {
+            Primask = NVIC_DisableExceptionsSave();
+            Gpio_WriteImage(Port, &Image);
+            NVIC_RestoreExceptions(Primask);
+        }
+    }
+}
@@ -0,0 +1,398 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Gpio.h                                                                    *
+ * [DESCRIPTION]    :           Header file for the GPIO driver of PORTA .. PORTF - masked DATA accesses  *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef GPIO_H_
+#define GPIO_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define GPIO_PORTS_COUNT              6
+
+#define GPIO_PIN_0                    0x01
+#define GPIO_PIN_1                    0x02
+#define GPIO_PIN_2                    0x04
+#define GPIO_PIN_3                    0x08
+#define GPIO_PIN_4                    0x10
+#define GPIO_PIN_5                    0x20
+#define GPIO_PIN_6                    0x40
+#define GPIO_PIN_7                    0x80
+#define GPIO_PINS_ALL                 0xFF
+
+/* Offsets of the registers from the base of a port */
+#define GPIO_DIR_OFFSET               0x400
+#define GPIO_IS_OFFSET                0x404
+#define GPIO_IBE_OFFSET               0x408
+#define GPIO_IEV_OFFSET               0x40C
+#define GPIO_IM_OFFSET                0x410
+#define GPIO_RIS_OFFSET               0x414
+#define GPIO_MIS_OFFSET               0x418
+#define GPIO_ICR_OFFSET               0x41C
+#define GPIO_AFSEL_OFFSET             0x420
+#define GPIO_PUR_OFFSET               0x510
+#define GPIO_PDR_OFFSET               0x514
+#define GPIO_DEN_OFFSET               0x51C
+#define GPIO_LOCK_OFFSET              0x520
+#define GPIO_CR_OFFSET                0x524
+#define GPIO_AMSEL_OFFSET             0x528
+#define GPIO_PCTL_OFFSET              0x52C
+
+/* Unlocks the commit register, needed for PD7 and PF0 (NMI) and PC0 .. PC3 (JTAG) */
+#define GPIO_LOCK_KEY                 0x4C4F434B
+
+/* Entries of a pins configuration table, PINS of PORT share the configuration */
+#define GPIO_PIN_INPUT(PORT, PINS, PULL, EDGE)  { (PORT), (PINS), GPIO_MODE_INPUT, (PULL), (EDGE), 0, 0 }
+#define GPIO_PIN_OUTPUT(PORT, PINS, LEVEL)      { (PORT), (PINS), GPIO_MODE_OUTPUT, GPIO_PULL_NONE, GPIO_EDGE_NONE, 0, (LEVEL) }
+#define GPIO_PIN_ALTERNATE(PORT, PINS, FUNCTION, PULL) \
+    { (PORT), (PINS), GPIO_MODE_ALTERNATE, (PULL), GPIO_EDGE_NONE, (FUNCTION), 0 }
+#define GPIO_PIN_ANALOG(PORT, PINS)             { (PORT), (PINS), GPIO_MODE_ANALOG, GPIO_PULL_NONE, GPIO_EDGE_NONE, 0, 0 }
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    GPIO_PORT_A,
+    GPIO_PORT_B,
+    GPIO_PORT_C,
+    GPIO_PORT_D,
+    GPIO_PORT_E,
+    GPIO_PORT_F
+}Gpio_PortType;
+
+/* Pins of a port, GPIO_PIN_n ORed together */
+typedef uint8 Gpio_PinsType;
+
+/* Aperture of the registers of a port, the AHB one takes a store per cycle where the APB one needs wait states */
+typedef enum
+{
+    GPIO_BUS_APB,
+    GPIO_BUS_AHB
+}Gpio_BusType;
+
+typedef enum
+{
+    GPIO_PULL_NONE,
+    GPIO_PULL_UP,
+    GPIO_PULL_DOWN
+}Gpio_PullType;
+
+typedef enum
+{
+    GPIO_EDGE_NONE,             /* Interrupt of the pins masked */
+    GPIO_EDGE_FALLING,
+    GPIO_EDGE_RISING,
+    GPIO_EDGE_BOTH
+}Gpio_EdgeType;
+
+typedef enum
+{
+    GPIO_MODE_INPUT,            /* Digital input, optionally interrupting on Edge */
+    GPIO_MODE_OUTPUT,           /* Digital output driven to Level */
+    GPIO_MODE_ALTERNATE,        /* Digital pin of the peripheral selected by Function (PCTL value) */
+    GPIO_MODE_ANALOG            /* Analog input of the ADC or the comparators, digital disabled */
+}Gpio_ModeType;
+
+/* Entry of a pins configuration table, built with GPIO_PIN_INPUT, GPIO_PIN_OUTPUT .. */
+typedef struct
+{
+    Gpio_PortType Port;
+    Gpio_PinsType Pins;
+    Gpio_ModeType Mode;
+    Gpio_PullType Pull;
+    Gpio_EdgeType Edge;
+    uint8         Function;
+    uint8         Level;        /* Initial levels of the outputs, one bit per pin */
+}Gpio_PinConfigType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Base address of every port on the bus selected by Gpio_EnablePort, only read by the inline functions */
+extern uint32 g_Gpio_PortBase[GPIO_PORTS_COUNT];
+
+/*******************************************************************************
+ *                      Inline Functions - Pins Functions                      *
+ *******************************************************************************/
+/* The pins are accessed through the DATA aperture, the address selects the pins so a write never
+ * changes the other pins of the port: no read-modify-write and no critical section against the ISRs
+ * writing other pins of the same port. With a constant port and pins every access is a load of the
+ * base and one store, the loops toggling pins take the base once with Gpio_GetPortBase. */
+
+/************************************************************************************
+* Service Name: Gpio_WritePins
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins written
+*                , a_Value - Levels of the pins, the bits outside a_Pins are ignored
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write a group of output pins with one store.
+************************************************************************************/
+static inline void Gpio_WritePins(Gpio_PortType a_Port, Gpio_PinsType a_Pins, uint8 a_Value)
+{
+    GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins) = a_Value;
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_SetPins
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins set to the high level
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set output pins with one store.
+************************************************************************************/
+static inline void Gpio_SetPins(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins) = GPIO_PINS_ALL;
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_ClearPins
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins cleared to the low level
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear output pins with one store.
+************************************************************************************/
+static inline void Gpio_ClearPins(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins) = 0;
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_TogglePins
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins inverted
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to invert output pins. It is the only accessor that is not a single store,
+*              the levels are read then written through the same aperture address. The other pins
+*              of the port are not touched, but a write of the same pins by an ISR between the read
+*              and the write is lost. The application writes the LEDs with Gpio_WritePins, from the
+*              level it keeps, and the toggle is left for pins owned by one context.
+************************************************************************************/
+static inline void Gpio_TogglePins(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins) = ~GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins);
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_ReadPins
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins read
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - Levels of the pins, the bits outside a_Pins are 0
+* Description: Function to read a group of pins with one load.
+************************************************************************************/
+static inline uint8 Gpio_ReadPins(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    return (uint8)GPIO_DATA_BITS_REG(g_Gpio_PortBase[a_Port], a_Pins);
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_GetPortBase
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Base address of the port on the bus selected by Gpio_EnablePort
+* Description: Function to get the base of a port once for the loops bit-banging a protocol, with the
+*              base in a local GPIO_DATA_BITS_REG(Base, Pins) is a single store. The base changes with
+*              the bus so it must be taken again after Gpio_EnablePort.
+************************************************************************************/
+static inline uint32 Gpio_GetPortBase(Gpio_PortType a_Port)
+{
+    return g_Gpio_PortBase[a_Port];
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_ClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins of the interrupt flags cleared
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear edge interrupt flags, ICR is write-1 to clear so one store is enough.
+************************************************************************************/
+static inline void Gpio_ClearInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins)
+{
+    GPIO_PORT_REG(g_Gpio_PortBase[a_Port], GPIO_ICR_OFFSET) = a_Pins;
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_GetInterruptStatus
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpio_PinsType - Pins with a pending and enabled interrupt
+* Description: Function to read the masked interrupt status of a port.
+************************************************************************************/
+static inline Gpio_PinsType Gpio_GetInterruptStatus(Gpio_PortType a_Port)
+{
+    return (Gpio_PinsType)GPIO_PORT_REG(g_Gpio_PortBase[a_Port], GPIO_MIS_OFFSET);
+}
+
+
+/************************************************************************************
+* Service Name: Gpio_GetRawInterruptStatus
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpio_PinsType - Pins with a pending interrupt, masked in IM or not
+* Description: Function to read the raw interrupt status of a port, the edges of the masked pins
+*              are still latched until they are cleared.
+************************************************************************************/
+static inline Gpio_PinsType Gpio_GetRawInterruptStatus(Gpio_PortType a_Port)
+{
+    return (Gpio_PinsType)GPIO_PORT_REG(g_Gpio_PortBase[a_Port], GPIO_RIS_OFFSET);
+}
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Gpio_EnablePort
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port to clock
+*                , a_Bus - Aperture of the registers of the port
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the bus of a port, enable its clock and wait until its registers
+*              are ready. The aperture not selected is not decoded anymore, the port must not be in
+*              use while it is switched.
+************************************************************************************/
+void Gpio_EnablePort(Gpio_PortType a_Port, Gpio_BusType a_Bus);
+
+
+/************************************************************************************
+* Service Name: Gpio_ConfigureOutput
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins configured as digital outputs, the other pins are not changed
+*                , a_Value - Initial levels of the pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure digital GPIO outputs, the levels are written before the
+*              direction so the pins never drive a stale level.
+************************************************************************************/
+void Gpio_ConfigureOutput(Gpio_PortType a_Port, Gpio_PinsType a_Pins, uint8 a_Value);
+
+
+/************************************************************************************
+* Service Name: Gpio_ConfigureInput
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins configured as digital inputs, the other pins are not changed
+*                , a_Pull - Pull resistor of the pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure digital GPIO inputs, the locked pins (PF0, PD7) are unlocked.
+************************************************************************************/
+void Gpio_ConfigureInput(Gpio_PortType a_Port, Gpio_PinsType a_Pins, Gpio_PullType a_Pull);
+
+
+/************************************************************************************
+* Service Name: Gpio_ConfigureInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Input pins detecting the edges
+*                , a_Edge - Edges detected
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure and enable the edge interrupt of input pins, the flags are
+*              cleared first and GPIO_EDGE_NONE masks it. The IRQ of the port is enabled in the NVIC
+*              by the caller.
+************************************************************************************/
+void Gpio_ConfigureInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins, Gpio_EdgeType a_Edge);
+
+
+/************************************************************************************
+* Service Name: Gpio_EnableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins of the interrupts unmasked
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to unmask the interrupt of pins configured by Gpio_ConfigureInterrupt, the
+*              flags latched while they were masked are cleared first.
+************************************************************************************/
+void Gpio_EnableInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins);
+
+
+/************************************************************************************
+* Service Name: Gpio_DisableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Port - Port of the pins
+*                , a_Pins - Pins of the interrupts masked
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to mask the interrupt of pins, their edges are still latched in RIS.
+************************************************************************************/
+void Gpio_DisableInterrupt(Gpio_PortType a_Port, Gpio_PinsType a_Pins);
+
+
+/************************************************************************************
+* Service Name: Gpio_ConfigurePins
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Table - Pins configuration table, the pins not in it are not changed
+*                , a_Count - Number of entries of the table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure the pins of a whole board at once. The entries of each port are
+*              merged into one value per register, a register is written once and only if its value
+*              changes, and without being read when the table covers all the pins of the port.
+*              The ports are enabled by Gpio_EnablePort first.
+************************************************************************************/
+void Gpio_ConfigurePins(const Gpio_PinConfigType *a_Table, uint8 a_Count);
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,211 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           GpioBench.c                                                               *
+ * [DESCRIPTION]    :           Source file for the GPIO toggle rate and ISR to pin latency benchmark     *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "GpioBench.h"
+#include "NVIC.h"
+#include "Delay.h"
+#include "Clock.h"
+#include "Line.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Longest line printed by GpioBench_Report */
+#define GPIO_BENCH_LINE_LENGTH        80
+
+/* 8 writes of the pin, high then low ... the base and the pin are in registers so each one is a single store */
+#define GPIO_BENCH_WRITE_8(BASE, PIN) \
+    GPIO_DATA_BITS_REG(BASE, PIN) = GPIO_PINS_ALL; GPIO_DATA_BITS_REG(BASE, PIN) = 0; \
+    GPIO_DATA_BITS_REG(BASE, PIN) = GPIO_PINS_ALL; GPIO_DATA_BITS_REG(BASE, PIN) = 0; \
+    GPIO_DATA_BITS_REG(BASE, PIN) = GPIO_PINS_ALL; GPIO_DATA_BITS_REG(BASE, PIN) = 0; \
+    GPIO_DATA_BITS_REG(BASE, PIN) = GPIO_PINS_ALL; GPIO_DATA_BITS_REG(BASE, PIN) = 0
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* IRQ number of the GPIO ports A .. F */
+static const NVIC_IRQType g_GpioBench_PortIrq[GPIO_PORTS_COUNT] = {0, 1, 2, 3, 4, 30};
+
+/* Pin written by GpioBench_Handler and the cycle counter once the write is done */
+static volatile uint32 g_GpioBench_Base;
+static volatile uint8 g_GpioBench_Pin;
+static volatile uint32 g_GpioBench_PinCycles;
+static volatile boolean g_GpioBench_Taken;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Handler of the port IRQ during the measurement, the pin is written first */
+static void GpioBench_Handler(void)
+{
+    GPIO_DATA_BITS_REG(g_GpioBench_Base, g_GpioBench_Pin) = GPIO_PINS_ALL;
+    Data_Sync_Barrier();
+    g_GpioBench_PinCycles = Delay_GetCycles();
+    g_GpioBench_Taken = TRUE;
+}
+
+/* Cycles of a timestamp pair and the barrier, removed from every measurement */
+static uint32 GpioBench_GetOverhead(void)
+{
+    uint32 Start;
+
+    Start = Delay_GetCycles();
+    Data_Sync_Barrier();
+    return Delay_GetElapsedCycles(Start);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: GpioBench_Run
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Port - Port of the pin
+ *                , a_Pin - Pin toggled, configured as an output by the benchmark
+ *                , a_Bus - Aperture measured, the port is left on it
+ * Parameters (inout): None
+ * Parameters (out): a_Result - Cycles measured
+ * Return value: boolean - FALSE if the IRQ of the port was never taken (exceptions disabled)
+ * Description: Function to measure the toggle rate of a pin and the latency from an interrupt to the
+ *              pin written by its handler on one bus. The handler of the port IRQ is replaced during
+ *              the measurement, it must be called before the interrupts of the port are configured.
+ ************************************************************************************/
+boolean GpioBench_Run(Gpio_PortType a_Port, Gpio_PinsType a_Pin, Gpio_BusType a_Bus, GpioBench_ResultType *a_Result)
+{
+    NVIC_IRQType Irq = g_GpioBench_PortIrq[a_Port];
+    NVIC_HandlerType Previous;
+    uint32 Overhead;
+    uint32 Base;
+    uint32 Start;
+    uint32 Cycles;
+    uint32 Primask;
+    uint8 Run;
+
+    Gpio_EnablePort(a_Port, a_Bus);
+    Gpio_ConfigureOutput(a_Port, a_Pin, 0);
+    Base = Gpio_GetPortBase(a_Port);
+    Overhead = GpioBench_GetOverhead();
+
+    /* Toggle rate ... no interrupt stretches the burst, the barrier waits for the last write on the bus */
+    Primask = NVIC_DisableExceptionsSave();
+    Start = Delay_GetCycles();
+    GPIO_BENCH_WRITE_8(Base, a_Pin);
+    GPIO_BENCH_WRITE_8(Base, a_Pin);
+    GPIO_BENCH_WRITE_8(Base, a_Pin);
+    GPIO_BENCH_WRITE_8(Base, a_Pin);
+    Data_Sync_Barrier();
+    Cycles = Delay_GetElapsedCycles(Start);
+    NVIC_RestoreExceptions(Primask);
+
+    a_Result->ToggleCycles = (Cycles > Overhead) ? (Cycles - Overhead) : 0;
+    a_Result->ToggleRateKHz = 0;
+    if(a_Result->ToggleCycles != 0)
+    {
+        /* Two writes per period */
+        a_Result->ToggleRateKHz = ((Clock_GetSystemClock() / 2000) * GPIO_BENCH_EDGES) / a_Result->ToggleCycles;
+    }
+
+    /* ISR to pin latency ... the IRQ of the port is triggered by software, the pin is low before each run */
+    g_GpioBench_Base = Base;
+    g_GpioBench_Pin = a_Pin;
+    a_Result->LatencyMin = 0xFFFFFFFF;
+    a_Result->LatencyMax = 0;
+    Previous = NVIC_RegisterHandler(NVIC_IRQ_VECTOR(Irq), GpioBench_Handler);
+    NVIC_EnableIRQ(Irq);
+
+    for(Run = 0; Run < GPIO_BENCH_LATENCY_RUNS; Run++)
+    {
+        GPIO_DATA_BITS_REG(Base, a_Pin) = 0;
+        g_GpioBench_Taken = FALSE;
+
+        Start = Delay_GetCycles();
+        NVIC_SW_TRIG_REG = Irq;
+        while((g_GpioBench_Taken == FALSE) && (Delay_GetElapsedCycles(Start) < GPIO_BENCH_TIMEOUT_CYCLES));
+        if(g_GpioBench_Taken == FALSE)
+        {
+            break;
+        }
+
+        Cycles = g_GpioBench_PinCycles - Start;
+        Cycles = (Cycles > Overhead) ? (Cycles - Overhead) : 0;
+        if(Cycles < a_Result->LatencyMin)
+        {
+            a_Result->LatencyMin = Cycles;
+        }
+        if(Cycles > a_Result->LatencyMax)
+        {
+            a_Result->LatencyMax = Cycles;
+        }
+    }
+
+    NVIC_DisableIRQ(Irq);
+    NVIC_RegisterHandler(NVIC_IRQ_VECTOR(Irq), Previous);
+    GPIO_DATA_BITS_REG(Base, a_Pin) = 0;
+
+    if(Run != GPIO_BENCH_LATENCY_RUNS)
+    {
+        a_Result->LatencyMin = 0;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: GpioBench_Report
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Port - Port of the pin
+ *                , a_Pin - Pin toggled, configured as an output by the benchmark
+ *                , a_PutString - Function writing one line of text
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to run the benchmark on the APB then on the AHB and print one line per bus:
+ *              "GPIO <bus> edges=<count> cycles=<cycles> toggle=<kHz>kHz isr=<min>..<max>",
+ *              the port is left on the AHB.
+ ************************************************************************************/
+void GpioBench_Report(Gpio_PortType a_Port, Gpio_PinsType a_Pin, GpioBench_PutStringType a_PutString)
+{
+    static const char * const Bus_Names[] = {"APB", "AHB"};
+    GpioBench_ResultType Result;
+    char Buffer[GPIO_BENCH_LINE_LENGTH];
+    Line_Type Line;
+    Gpio_BusType Bus;
+    boolean Taken;
+
+    for(Bus = GPIO_BUS_APB; Bus <= GPIO_BUS_AHB; Bus++)
+    {
+        Taken = GpioBench_Run(a_Port, a_Pin, Bus, &Result);
+
+        Line_Init(&Line, Buffer, sizeof(Buffer));
+        Line_AppendString(&Line, "GPIO ");
+        Line_AppendString(&Line, Bus_Names[Bus]);
+        Line_AppendString(&Line, " edges=");
+        Line_AppendNumber(&Line, GPIO_BENCH_EDGES);
+        Line_AppendString(&Line, " cycles=");
+        Line_AppendNumber(&Line, Result.ToggleCycles);
+        Line_AppendString(&Line, " toggle=");
+        Line_AppendNumber(&Line, Result.ToggleRateKHz);
+        Line_AppendString(&Line, "kHz isr=");
+        if(Taken == TRUE)
+        {
+            Line_AppendNumber(&Line, Result.LatencyMin);
+            Line_AppendString(&Line, "..");
+            Line_AppendNumber(&Line, Result.LatencyMax);
+        }
+        else
+        {
+            Line_AppendString(&Line, "none");
+        }
+        Line_AppendString(&Line, "\r\n");
+
+        a_PutString(Buffer);
+    }
+}
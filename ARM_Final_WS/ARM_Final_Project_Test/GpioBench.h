@@ -0,0 +1,82 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           GpioBench.h                                                               *
+ * [DESCRIPTION]    :           Header file for the GPIO toggle rate and ISR to pin latency benchmark     *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef GPIOBENCH_H_
+#define GPIOBENCH_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "Gpio.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Set to 1 to run the benchmark at boot, it delays the start of the application and drives the
+ * Red LED pin before it is configured ... off in the firmware, the simulator build enables it */
+#ifndef GPIO_BENCH_ENABLE
+#define GPIO_BENCH_ENABLE             0
+#endif
+
+/* Back to back writes of the pin timed by one measurement, the writes are unrolled */
+#define GPIO_BENCH_EDGES              32
+
+/* Software triggers of the IRQ of the port, the latency is the min and max of the runs */
+#define GPIO_BENCH_LATENCY_RUNS       16
+
+/* Cycles waited for the handler before the IRQ is considered not taken */
+#define GPIO_BENCH_TIMEOUT_CYCLES     10000
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 ToggleCycles;        /* Cycles of GPIO_BENCH_EDGES writes of the pin, the timestamps excluded */
+    uint32 ToggleRateKHz;       /* Frequency of the square wave generated by the writes */
+    uint32 LatencyMin;          /* Cycles from the software trigger of the IRQ to the pin written by its handler */
+    uint32 LatencyMax;
+}GpioBench_ResultType;
+
+/* Output of GpioBench_Report, called with one line at a time */
+typedef void (*GpioBench_PutStringType)(const char *a_String);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: GpioBench_Run
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Port - Port of the pin
+*                , a_Pin - Pin toggled, configured as an output by the benchmark
+*                , a_Bus - Aperture measured, the port is left on it
+* Parameters (inout): None
+* Parameters (out): a_Result - Cycles measured
+* Return value: boolean - FALSE if the IRQ of the port was never taken (exceptions disabled)
+* Description: Function to measure the toggle rate of a pin and the latency from an interrupt to the
+*              pin written by its handler on one bus. The handler of the port IRQ is replaced during
+*              the measurement, it must be called before the interrupts of the port are configured.
+************************************************************************************/
+boolean GpioBench_Run(Gpio_PortType a_Port, Gpio_PinsType a_Pin, Gpio_BusType a_Bus, GpioBench_ResultType *a_Result);
+
+
+/************************************************************************************
+* Service Name: GpioBench_Report
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Port - Port of the pin
+*                , a_Pin - Pin toggled, configured as an output by the benchmark
+*                , a_PutString - Function writing one line of text
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to run the benchmark on the APB then on the AHB and print one line per bus:
+*              "GPIO <bus> edges=<count> cycles=<cycles> toggle=<kHz>kHz isr=<min>..<max>",
+*              the port is left on the AHB.
+************************************************************************************/
+void GpioBench_Report(Gpio_PortType a_Port, Gpio_PinsType a_Pin, GpioBench_PutStringType a_PutString);
+
+#endif /* GPIOBENCH_H_ */
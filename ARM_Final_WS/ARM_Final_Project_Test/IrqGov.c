@@ -0,0 +1,374 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           IrqGov.c                                                                  *
+ * [DESCRIPTION]    :           Source file for the interrupt load governor - storms shed to polling      *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "IrqGov.h"
+#include "SwTimer.h"
+#include "SysTick.h"
+#include "Log.h"
+#include "Line.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define IRQ_GOV_NO_SOURCE             0xFF
+
+/* Longest line printed by IrqGov_Dump */
+#define IRQ_GOV_LINE_LENGTH           96
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* State of a source ... written by its handler, and by the polling timer with the exceptions disabled */
+typedef struct
+{
+    const IrqGov_ConfigType *Config;
+    IrqGov_MetricsType Metrics;
+    uint32  WindowStart;        /* Tick count at the first activation of the window */
+    uint32  ShedTick;           /* Tick count when the source was shed */
+    uint16  WindowCount;        /* Activations in the window */
+    uint16  QuietTicks;         /* Polled ticks without a request since the last one */
+    volatile boolean Shed;
+}IrqGov_SourceType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static IrqGov_SourceType g_IrqGov_Sources[IRQ_GOV_MAX_SOURCES];
+static uint8 g_IrqGov_SourcesCount = 0;
+
+/* Source of each IRQ, IRQ_GOV_NO_SOURCE if the IRQ is not governed */
+static uint8 g_IrqGov_SourceOfIrq[NVIC_IRQ_MAX + 1];
+
+/* Polls the shed sources while one of them is shed */
+static SwTimer_Type g_IrqGov_Timer;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Stop the requests of a source reaching the processor */
+static void IrqGov_Mask(const IrqGov_ConfigType *a_Config)
+{
+    if(a_Config->Pins != 0)
+    {
+        Gpio_DisableInterrupt(a_Config->Port, a_Config->Pins);
+    }
+    else
+    {
+        NVIC_DisableIRQ(a_Config->Irq);
+    }
+}
+
+/* Let the requests of a source interrupt again, the requests latched while it was shed are dropped */
+static void IrqGov_Unmask(const IrqGov_ConfigType *a_Config)
+{
+    if(a_Config->Pins != 0)
+    {
+        Gpio_EnableInterrupt(a_Config->Port, a_Config->Pins);
+    }
+    else
+    {
+        NVIC_ClearPendingIRQ(a_Config->Irq);
+        NVIC_EnableIRQ(a_Config->Irq);
+    }
+}
+
+/* Request of a shed source latched since the last call, it is cleared ... the masked GPIO edges are
+ * still latched in RIS and a disabled IRQ is still pended */
+static boolean IrqGov_TakeRequest(const IrqGov_ConfigType *a_Config)
+{
+    Gpio_PinsType Pins;
+
+    if(a_Config->Pins != 0)
+    {
+        Pins = (Gpio_PinsType)(Gpio_GetRawInterruptStatus(a_Config->Port) & a_Config->Pins);
+        if(Pins == 0)
+        {
+            return FALSE;
+        }
+        Gpio_ClearInterrupt(a_Config->Port, Pins);
+        return TRUE;
+    }
+
+    if(NVIC_IsPendingIRQ(a_Config->Irq) == FALSE)
+    {
+        return FALSE;
+    }
+    NVIC_ClearPendingIRQ(a_Config->Irq);
+    return TRUE;
+}
+
+/* SwTimer call back, every shed source is polled and re-armed once it is quiet */
+static void IrqGov_Poll(void *a_Context)
+{
+    IrqGov_SourceType *Source;
+    boolean Shed = FALSE;
+    uint32 Tick = SysTick_GetTickCount();
+    uint32 Ticks;
+    uint32 Primask;
+    uint8 Index;
+
+    for(Index = 0; Index < g_IrqGov_SourcesCount; Index++)
+    {
+        Source = &g_IrqGov_Sources[Index];
+        if(Source->Shed == FALSE)
+        {
+            continue;
+        }
+
+        Source->Metrics.PolledTicks++;
+        if(Source->Config->Poll != NULL_PTR)
+        {
+            Source->Config->Poll();
+        }
+
+        /* The handler of the source may run between the checks if something unmasked it */
+        Primask = NVIC_DisableExceptionsSave();
+        if(IrqGov_TakeRequest(Source->Config) == TRUE)
+        {
+            Source->QuietTicks = 0;
+        }
+        else
+        {
+            Source->QuietTicks++;
+        }
+
+        if(Source->QuietTicks >= IRQ_GOV_QUIET_TICKS)
+        {
+            Ticks = Tick - Source->ShedTick;
+            if(Ticks > Source->Metrics.LongestStorm)
+            {
+                Source->Metrics.LongestStorm = Ticks;
+            }
+            Source->WindowStart = Tick;
+            Source->WindowCount = 0;
+            Source->Shed = FALSE;
+            IrqGov_Unmask(Source->Config);
+            LOG2("IRQ %u re-armed after %u ticks", Source->Config->Irq, Ticks);
+        }
+        else
+        {
+            Shed = TRUE;
+        }
+        NVIC_RestoreExceptions(Primask);
+    }
+
+    if(Shed == FALSE)
+    {
+        SwTimer_Stop(&g_IrqGov_Timer);
+    }
+}
+
+/* Mask a source above its budget and poll it until the storm is over */
+static void IrqGov_ShedSource(IrqGov_SourceType *a_Source, uint32 a_Tick)
+{
+    IrqGov_Mask(a_Source->Config);
+    a_Source->QuietTicks = 0;
+
+    /* A source already shed was unmasked by another owner of the mask, it is the same storm */
+    if(a_Source->Shed == FALSE)
+    {
+        a_Source->Shed = TRUE;
+        a_Source->ShedTick = a_Tick;
+        a_Source->Metrics.Storms++;
+        LOG2("IRQ %u storm, %u activations in the window", a_Source->Config->Irq, a_Source->WindowCount);
+    }
+
+    if(SwTimer_IsActive(&g_IrqGov_Timer) == FALSE)
+    {
+        SwTimer_Start(&g_IrqGov_Timer, 1, 1);
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: IrqGov_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Table - Sources governed, one IRQ each
+ *                , a_Count - Number of sources, up to IRQ_GOV_MAX_SOURCES
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if there are too many sources or an IRQ is out of range
+ * Description: Function to start counting the activations of the sources. Their handlers call
+ *              IrqGov_Admit first. Must be called after SwTimer_Init and before the IRQs are enabled.
+ ************************************************************************************/
+boolean IrqGov_Init(const IrqGov_ConfigType *a_Table, uint8 a_Count)
+{
+    IrqGov_SourceType *Source;
+    uint32 Tick = SysTick_GetTickCount();
+    uint8 Index;
+
+    if(a_Count > IRQ_GOV_MAX_SOURCES)
+    {
+        return FALSE;
+    }
+    for(Index = 0; Index < a_Count; Index++)
+    {
+        if(a_Table[Index].Irq > NVIC_IRQ_MAX)
+        {
+            return FALSE;
+        }
+    }
+
+    for(Index = 0; Index <= NVIC_IRQ_MAX; Index++)
+    {
+        g_IrqGov_SourceOfIrq[Index] = IRQ_GOV_NO_SOURCE;
+    }
+
+    SwTimer_Create(&g_IrqGov_Timer, IrqGov_Poll, NULL_PTR);
+
+    for(Index = 0; Index < a_Count; Index++)
+    {
+        Source = &g_IrqGov_Sources[Index];
+        Source->Config = &a_Table[Index];
+        Source->Metrics.Activations = 0;
+        Source->Metrics.Storms = 0;
+        Source->Metrics.PolledTicks = 0;
+        Source->Metrics.LongestStorm = 0;
+        Source->Metrics.Peak = 0;
+        Source->WindowStart = Tick;
+        Source->WindowCount = 0;
+        Source->QuietTicks = 0;
+        Source->Shed = FALSE;
+        g_IrqGov_SourceOfIrq[a_Table[Index].Irq] = Index;
+    }
+    g_IrqGov_SourcesCount = a_Count;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: IrqGov_Admit
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the handler must return without doing its work
+ * Description: Function to count an activation of the active handler, the IRQ is read from the
+ *              Interrupt Control and State register. The activation above the budget of the window
+ *              masks the source and switches it to polling, so a source costs at most Budget + 1
+ *              handler runs per window whatever its input does. An IRQ not governed is admitted.
+ ************************************************************************************/
+boolean IrqGov_Admit(void)
+{
+    IrqGov_SourceType *Source;
+    uint32 Vector = NVIC_SYSTEM_INTCTRL & IRQ_GOV_VECTACTIVE_MASK;
+    uint32 Tick;
+    uint8 Index;
+
+    if((Vector < NVIC_IRQ_VECTOR(0)) || (Vector > NVIC_IRQ_VECTOR(NVIC_IRQ_MAX)))
+    {
+        return TRUE;
+    }
+    Index = g_IrqGov_SourceOfIrq[Vector - NVIC_IRQ_VECTOR(0)];
+    if(Index == IRQ_GOV_NO_SOURCE)
+    {
+        return TRUE;
+    }
+
+    Source = &g_IrqGov_Sources[Index];
+    Tick = SysTick_GetTickCount();
+    Source->Metrics.Activations++;
+
+    /* The window starts at its first activation, a source interrupting once in a while never counts up */
+    if((Tick - Source->WindowStart) >= IRQ_GOV_WINDOW_TICKS)
+    {
+        Source->WindowStart = Tick;
+        Source->WindowCount = 0;
+    }
+    if(Source->WindowCount != 0xFFFF)
+    {
+        Source->WindowCount++;
+    }
+    if(Source->WindowCount > Source->Metrics.Peak)
+    {
+        Source->Metrics.Peak = Source->WindowCount;
+    }
+
+    if((Source->WindowCount <= Source->Config->Budget) && (Source->Shed == FALSE))
+    {
+        return TRUE;
+    }
+
+    IrqGov_ShedSource(Source, Tick);
+    return FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: IrqGov_GetMetrics
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Source - Index of the source in the configuration table
+ * Parameters (inout): None
+ * Parameters (out): a_Metrics - Counters of the source
+ * Return value: boolean - FALSE for an unknown source
+ * Description: Function to read the counters of a source, can be called while it is active.
+ ************************************************************************************/
+boolean IrqGov_GetMetrics(uint8 a_Source, IrqGov_MetricsType *a_Metrics)
+{
+    uint32 Primask;
+
+    if(a_Source >= g_IrqGov_SourcesCount)
+    {
+        return FALSE;
+    }
+
+    Primask = NVIC_DisableExceptionsSave();
+    *a_Metrics = g_IrqGov_Sources[a_Source].Metrics;
+    NVIC_RestoreExceptions(Primask);
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: IrqGov_Dump
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_PutString - Function writing one line of text
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to print the counters of every source, one line per source:
+ *              "G<irq> n=<activations> peak=<per window> storms=<count> polled=<ticks> longest=<ticks>".
+ *              Must be called from thread mode.
+ ************************************************************************************/
+void IrqGov_Dump(IrqGov_PutStringType a_PutString)
+{
+    IrqGov_MetricsType Metrics;
+    char Buffer[IRQ_GOV_LINE_LENGTH];
+    Line_Type Line;
+    uint8 Index;
+
+    for(Index = 0; Index < g_IrqGov_SourcesCount; Index++)
+    {
+        IrqGov_GetMetrics(Index, &Metrics);
+
+        Line_Init(&Line, Buffer, sizeof(Buffer));
+        Line_AppendString(&Line, "G");
+        Line_AppendNumber(&Line, g_IrqGov_Sources[Index].Config->Irq);
+        Line_AppendString(&Line, " n=");
+        Line_AppendNumber(&Line, Metrics.Activations);
+        Line_AppendString(&Line, " peak=");
+        Line_AppendNumber(&Line, Metrics.Peak);
+        Line_AppendString(&Line, " storms=");
+        Line_AppendNumber(&Line, Metrics.Storms);
+        Line_AppendString(&Line, " polled=");
+        Line_AppendNumber(&Line, Metrics.PolledTicks);
+        Line_AppendString(&Line, " longest=");
+        Line_AppendNumber(&Line, Metrics.LongestStorm);
+        Line_AppendString(&Line, "\r\n");
+
+        a_PutString(Buffer);
+    }
+}
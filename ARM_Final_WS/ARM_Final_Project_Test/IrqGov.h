@@ -0,0 +1,118 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           IrqGov.h                                                                  *
+ * [DESCRIPTION]    :           Header file for the interrupt load governor - storms shed to polling      *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef IRQGOV_H_
+#define IRQGOV_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "NVIC.h"
+#include "Gpio.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* IRQs governed at the same time, one per entry of the configuration table */
+#define IRQ_GOV_MAX_SOURCES           4
+
+/* Activations of a source are counted per window of SysTick ticks ... 100 ms with the 10 ms tick */
+#define IRQ_GOV_WINDOW_TICKS          10
+
+/* A shed source is polled on every tick and re-armed after this many ticks without a request */
+#define IRQ_GOV_QUIET_TICKS           10
+
+/* Active vector number field of the Interrupt Control and State register */
+#define IRQ_GOV_VECTACTIVE_MASK       0x000000FF
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Work of the handler done by polling while the source is shed, called from the SysTick handler */
+typedef void (*IrqGov_PollType)(void);
+
+typedef struct
+{
+    NVIC_IRQType    Irq;
+    uint16          Budget;     /* Activations admitted per window, the next one sheds the source */
+    Gpio_PortType   Port;
+    Gpio_PinsType   Pins;       /* Edge pins masked in IM while shed, 0 to disable the IRQ in the NVIC */
+    IrqGov_PollType Poll;       /* Must clear the request of the source, NULL_PTR if nothing is polled */
+}IrqGov_ConfigType;
+
+typedef struct
+{
+    uint32 Activations;         /* Handler entries, admitted or not */
+    uint32 Storms;              /* Times the source was shed */
+    uint32 PolledTicks;         /* Ticks the source was polled instead of interrupting */
+    uint32 LongestStorm;        /* Most ticks shed in one storm */
+    uint16 Peak;                /* Most activations in one window */
+}IrqGov_MetricsType;
+
+/* Output of IrqGov_Dump, called with one line at a time */
+typedef void (*IrqGov_PutStringType)(const char *a_String);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: IrqGov_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Table - Sources governed, one IRQ each
+*                , a_Count - Number of sources, up to IRQ_GOV_MAX_SOURCES
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if there are too many sources or an IRQ is out of range
+* Description: Function to start counting the activations of the sources. Their handlers call
+*              IrqGov_Admit first. Must be called after SwTimer_Init and before the IRQs are enabled.
+************************************************************************************/
+boolean IrqGov_Init(const IrqGov_ConfigType *a_Table, uint8 a_Count);
+
+
+/************************************************************************************
+* Service Name: IrqGov_Admit
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the handler must return without doing its work
+* Description: Function to count an activation of the active handler, the IRQ is read from the
+*              Interrupt Control and State register. The activation above the budget of the window
+*              masks the source and switches it to polling, so a source costs at most Budget + 1
+*              handler runs per window whatever its input does. An IRQ not governed is admitted.
+************************************************************************************/
+boolean IrqGov_Admit(void);
+
+
+/************************************************************************************
+* Service Name: IrqGov_GetMetrics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Source - Index of the source in the configuration table
+* Parameters (inout): None
+* Parameters (out): a_Metrics - Counters of the source
+* Return value: boolean - FALSE for an unknown source
+* Description: Function to read the counters of a source, can be called while it is active.
+************************************************************************************/
+boolean IrqGov_GetMetrics(uint8 a_Source, IrqGov_MetricsType *a_Metrics);
+
+
+/************************************************************************************
+* Service Name: IrqGov_Dump
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_PutString - Function writing one line of text
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to print the counters of every source, one line per source:
+*              "G<irq> n=<activations> peak=<per window> storms=<count> polled=<ticks> longest=<ticks>".
+*              Must be called from thread mode.
+************************************************************************************/
+void IrqGov_Dump(IrqGov_PutStringType a_PutString);
+
+#endif /* IRQGOV_H_ */
@@ -0,0 +1,402 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           IsrStats.c                                                                *
+ * [DESCRIPTION]    :           Source file for the interrupt latency and jitter instrumentation          *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "IsrStats.h"
+#include "NVIC.h"
+#include "Line.h"
+#include "common_macros.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define ISR_STATS_METRICS_COUNT       3
+
+/* Longest line printed by IsrStats_Dump */
+#define ISR_STATS_LINE_LENGTH         96
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Statistics of one vector ... only written by its own handler (a handler does not preempt itself) */
+typedef struct
+{
+    IsrStats_HistogramType Histograms[ISR_STATS_METRICS_COUNT];
+    uint32  EntryCycles;            /* DWT timestamp of the running entry */
+    uint32  LastArrivalCycles;      /* DWT timestamp of the previous entry */
+    uint32  LastPeriodCycles;       /* Previous inter-arrival time */
+    uint32  TriggerCycles;          /* DWT timestamp recorded by IsrStats_MarkTrigger */
+    volatile boolean TriggerMarked;
+    uint8   Arrivals;               /* Entries counted up to 2, the jitter needs two inter-arrival times */
+    uint8   Vector;
+}IsrStats_SlotType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static IsrStats_SlotType g_IsrStats_Slots[ISR_STATS_SLOTS_COUNT];
+
+/* Slot of each vector plus one, 0 if the vector has no slot */
+static volatile uint8 g_IsrStats_SlotOfVector[ISR_STATS_VECTORS_COUNT];
+static uint8 g_IsrStats_UsedSlots = 0;
+
+static const char * const g_IsrStats_MetricsNames[ISR_STATS_METRICS_COUNT] = {"LAT", "EXE", "JIT"};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Clear the histograms of a slot */
+static void IsrStats_ClearSlot(IsrStats_SlotType *a_Slot)
+{
+    uint8 Metric;
+    uint8 Bucket;
+
+    for(Metric = 0; Metric < ISR_STATS_METRICS_COUNT; Metric++)
+    {
+        a_Slot->Histograms[Metric].Count = 0;
+        a_Slot->Histograms[Metric].Min = 0xFFFFFFFF;
+        a_Slot->Histograms[Metric].Max = 0;
+        for(Bucket = 0; Bucket < ISR_STATS_BUCKETS_COUNT; Bucket++)
+        {
+            a_Slot->Histograms[Metric].Buckets[Bucket] = 0;
+        }
+    }
+    a_Slot->TriggerMarked = FALSE;
+    a_Slot->Arrivals = 0;
+}
+
+/* Get the slot of a vector, a free slot is assigned to it if requested */
+static IsrStats_SlotType * IsrStats_GetSlot(uint8 a_Vector, boolean a_Assign)
+{
+    uint32 Primask;
+    uint8 Slot;
+
+    if(a_Vector >= ISR_STATS_VECTORS_COUNT)
+    {
+        return NULL_PTR;
+    }
+
+    Slot = g_IsrStats_SlotOfVector[a_Vector];
+    if((Slot == 0) && (a_Assign == TRUE))
+    {
+        /* First entry of the vector, a higher priority handler may assign a slot at the same time */
+        Primask = NVIC_DisableExceptionsSave();
+        Slot = g_IsrStats_SlotOfVector[a_Vector];
+        if((Slot == 0) && (g_IsrStats_UsedSlots < ISR_STATS_SLOTS_COUNT))
+        {
+            IsrStats_ClearSlot(&g_IsrStats_Slots[g_IsrStats_UsedSlots]);
+            g_IsrStats_Slots[g_IsrStats_UsedSlots].Vector = a_Vector;
+            g_IsrStats_UsedSlots++;
+            Slot = g_IsrStats_UsedSlots;
+            g_IsrStats_SlotOfVector[a_Vector] = Slot;
+        }
+        NVIC_RestoreExceptions(Primask);
+    }
+
+    if(Slot == 0)
+    {
+        return NULL_PTR;
+    }
+
+    return &g_IsrStats_Slots[Slot - 1];
+}
+
+/* Add a sample to a histogram */
+static void IsrStats_Record(IsrStats_HistogramType *a_Histogram, uint32 a_Cycles)
+{
+    a_Histogram->Count++;
+    if(a_Cycles < a_Histogram->Min)
+    {
+        a_Histogram->Min = a_Cycles;
+    }
+    if(a_Cycles > a_Histogram->Max)
+    {
+        a_Histogram->Max = a_Cycles;
+    }
+
+    /* The bucket is the number of significant bits */
+    a_Histogram->Buckets[32 - COUNT_LEADING_ZEROS(a_Cycles)]++;
+}
+
+/* Upper limit of the bucket holding the a_Percent percentile */
+static uint32 IsrStats_Percentile(const IsrStats_HistogramType *a_Histogram, uint32 a_Count, uint32 a_Percent)
+{
+    uint32 Target = (uint32)((((uint64)a_Count * a_Percent) + 99) / 100);
+    uint32 Cumulative = 0;
+    uint32 Upper_Limit = 0;
+    uint8 Bucket;
+
+    for(Bucket = 0; Bucket < ISR_STATS_BUCKETS_COUNT; Bucket++)
+    {
+        Cumulative += a_Histogram->Buckets[Bucket];
+        if(Cumulative >= Target)
+        {
+            Upper_Limit = (Bucket == 32) ? 0xFFFFFFFF : ((uint32)1 << Bucket) - 1;
+            break;
+        }
+    }
+
+    return (Upper_Limit < a_Histogram->Max) ? Upper_Limit : a_Histogram->Max;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: IsrStats_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Clear all the statistics and release the slots. Must be called after Delay_Init
+ *              (the DWT cycle counter is the time base) and before the interrupts are enabled.
+ ************************************************************************************/
+void IsrStats_Init(void)
+{
+    uint8 Vector;
+
+    for(Vector = 0; Vector < ISR_STATS_VECTORS_COUNT; Vector++)
+    {
+        g_IsrStats_SlotOfVector[Vector] = 0;
+    }
+    g_IsrStats_UsedSlots = 0;
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_Enter
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to record the entry of the active handler, the vector is read from the
+ *              Interrupt Control and State register. The SysTick latency is measured from the
+ *              counter re-load, the latency of the other vectors from the time recorded by
+ *              IsrStats_MarkTrigger if any.
+ ************************************************************************************/
+void IsrStats_Enter(void)
+{
+    IsrStats_SlotType *Slot;
+    uint32 Now = DWT_CYCCNT_REG;
+    uint32 Period;
+    uint8 Vector = (uint8)(NVIC_SYSTEM_INTCTRL & ISR_STATS_VECTACTIVE_MASK);
+
+    Slot = IsrStats_GetSlot(Vector, TRUE);
+    if(Slot == NULL_PTR)
+    {
+        return;
+    }
+
+    if(Vector == ISR_STATS_SYSTICK_VECTOR)
+    {
+        /* The interrupt is requested when the counter re-loads, the reload register still holds the
+         * loaded value because the handler did not queue the next one yet. Both count the system clock */
+        IsrStats_Record(&Slot->Histograms[ISR_STATS_LATENCY], SYSTICK_RELOAD_REG - SYSTICK_CURRENT_REG);
+    }
+    else if(Slot->TriggerMarked == TRUE)
+    {
+        Slot->TriggerMarked = FALSE;
+        IsrStats_Record(&Slot->Histograms[ISR_STATS_LATENCY], Now - Slot->TriggerCycles);
+    }
+
+    /* Inter-arrival jitter, the DWT counter wraps every 2^32 cycles (53 seconds at 80 MHz) */
+    if(Slot->Arrivals != 0)
+    {
+        Period = Now - Slot->LastArrivalCycles;
+        if(Slot->Arrivals == 2)
+        {
+            IsrStats_Record(&Slot->Histograms[ISR_STATS_JITTER],
+                            (Period > Slot->LastPeriodCycles) ? (Period - Slot->LastPeriodCycles) : (Slot->LastPeriodCycles - Period));
+        }
+        else
+        {
+            Slot->Arrivals = 2;
+        }
+        Slot->LastPeriodCycles = Period;
+    }
+    else
+    {
+        Slot->Arrivals = 1;
+    }
+    Slot->LastArrivalCycles = Now;
+    Slot->EntryCycles = Now;
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_Exit
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to record the exit of the active handler and its execution time.
+ ************************************************************************************/
+void IsrStats_Exit(void)
+{
+    IsrStats_SlotType *Slot;
+    uint32 Now = DWT_CYCCNT_REG;
+
+    Slot = IsrStats_GetSlot((uint8)(NVIC_SYSTEM_INTCTRL & ISR_STATS_VECTACTIVE_MASK), FALSE);
+    if(Slot == NULL_PTR)
+    {
+        return;
+    }
+
+    IsrStats_Record(&Slot->Histograms[ISR_STATS_EXECUTION], Now - Slot->EntryCycles);
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_MarkTrigger
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Vector - Vector number of the interrupt about to be requested
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to record the time an interrupt is requested (before it is pended by software,
+ *              or when the event time of a peripheral is known), its next entry records the latency.
+ ************************************************************************************/
+void IsrStats_MarkTrigger(uint8 a_Vector)
+{
+    IsrStats_SlotType *Slot = IsrStats_GetSlot(a_Vector, TRUE);
+
+    if(Slot != NULL_PTR)
+    {
+        Slot->TriggerCycles = DWT_CYCCNT_REG;
+        Slot->TriggerMarked = TRUE;
+    }
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_GetSummary
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Vector - Vector number, 15 for SysTick and 16 + IRQ number for the interrupts
+ *                , a_Metric - Histogram to summarize
+ * Parameters (inout): None
+ * Parameters (out): a_Summary - Count, minimum, maximum and percentiles in cycles
+ * Return value: boolean - FALSE if the vector was never measured
+ * Description: Function to summarize a histogram, can be called while the handler is active.
+ ************************************************************************************/
+boolean IsrStats_GetSummary(uint8 a_Vector, IsrStats_MetricType a_Metric, IsrStats_SummaryType *a_Summary)
+{
+    IsrStats_SlotType *Slot = IsrStats_GetSlot(a_Vector, FALSE);
+    IsrStats_HistogramType *Histogram;
+
+    if((Slot == NULL_PTR) || (a_Metric >= ISR_STATS_METRICS_COUNT))
+    {
+        return FALSE;
+    }
+
+    Histogram = &Slot->Histograms[a_Metric];
+
+    /* The handler may add samples meanwhile, the percentiles use the count read first */
+    a_Summary->Count = Histogram->Count;
+    if(a_Summary->Count == 0)
+    {
+        a_Summary->Min = 0;
+        a_Summary->Max = 0;
+        a_Summary->Percentile50 = 0;
+        a_Summary->Percentile90 = 0;
+        a_Summary->Percentile99 = 0;
+        return TRUE;
+    }
+
+    a_Summary->Min = Histogram->Min;
+    a_Summary->Max = Histogram->Max;
+    a_Summary->Percentile50 = IsrStats_Percentile(Histogram, a_Summary->Count, 50);
+    a_Summary->Percentile90 = IsrStats_Percentile(Histogram, a_Summary->Count, 90);
+    a_Summary->Percentile99 = IsrStats_Percentile(Histogram, a_Summary->Count, 99);
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_Reset
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to clear the histograms, the slots stay assigned to their vectors.
+ ************************************************************************************/
+void IsrStats_Reset(void)
+{
+    uint32 Primask;
+    uint8 Slot;
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    for(Slot = 0; Slot < g_IsrStats_UsedSlots; Slot++)
+    {
+        IsrStats_ClearSlot(&g_IsrStats_Slots[Slot]);
+    }
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: IsrStats_Dump
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_PutString - Function writing one line of text
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to print the summary of every measured vector, one line per metric:
+ *              "V<vector> <LAT|EXE|JIT> n=<count> min=<> p50=<> p90=<> p99=<> max=<>" in cycles.
+ *              Must be called from thread mode, the formatting is slow.
+ ************************************************************************************/
+void IsrStats_Dump(IsrStats_PutStringType a_PutString)
+{
+    IsrStats_SummaryType Summary;
+    char Buffer[ISR_STATS_LINE_LENGTH];
+    Line_Type Line;
+    uint8 Slot;
+    uint8 Metric;
+
+    for(Slot = 0; Slot < g_IsrStats_UsedSlots; Slot++)
+    {
+        for(Metric = 0; Metric < ISR_STATS_METRICS_COUNT; Metric++)
+        {
+            IsrStats_GetSummary(g_IsrStats_Slots[Slot].Vector, (IsrStats_MetricType)Metric, &Summary);
+
+            Line_Init(&Line, Buffer, sizeof(Buffer));
+            Line_AppendString(&Line, "V");
+            Line_AppendNumber(&Line, g_IsrStats_Slots[Slot].Vector);
+            Line_AppendString(&Line, " ");
+            Line_AppendString(&Line, g_IsrStats_MetricsNames[Metric]);
+            Line_AppendString(&Line, " n=");
+            Line_AppendNumber(&Line, Summary.Count);
+            Line_AppendString(&Line, " min=");
+            Line_AppendNumber(&Line, Summary.Min);
+            Line_AppendString(&Line, " p50=");
+            Line_AppendNumber(&Line, Summary.Percentile50);
+            Line_AppendString(&Line, " p90=");
+            Line_AppendNumber(&Line, Summary.Percentile90);
+            Line_AppendString(&Line, " p99=");
+            Line_AppendNumber(&Line, Summary.Percentile99);
+            Line_AppendString(&Line, " max=");
+            Line_AppendNumber(&Line, Summary.Max);
+            Line_AppendString(&Line, "\r\n");
+
+            a_PutString(Buffer);
+        }
+    }
+}
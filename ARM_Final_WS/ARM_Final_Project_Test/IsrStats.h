@@ -0,0 +1,175 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           IsrStats.h                                                                *
+ * [DESCRIPTION]    :           Header file for the interrupt latency and jitter instrumentation          *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef ISRSTATS_H_
+#define ISRSTATS_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Set to 0 to remove the instrumentation from all the handlers */
+#define ISR_STATS_ENABLE              1
+
+/* Number of entries of g_pfnVectors, the statistics are indexed by the vector number */
+#define ISR_STATS_VECTORS_COUNT       155
+#define ISR_STATS_SYSTICK_VECTOR      15
+
+/* Number of vectors that can be measured at the same time, a slot is taken on the first entry */
+#define ISR_STATS_SLOTS_COUNT         6
+
+/* Logarithmic histograms ... bucket 0 counts the value 0 and bucket N counts [2^(N-1), 2^N - 1] cycles */
+#define ISR_STATS_BUCKETS_COUNT       33
+
+/* Active vector number field of the Interrupt Control and State register */
+#define ISR_STATS_VECTACTIVE_MASK     0x000000FF
+
+/* Call ISR_STATS_ENTER first (after SysTick_EnterInterrupt in a SysTick handler) and ISR_STATS_EXIT last
+ * in every handler of g_pfnVectors to be measured */
+#if (ISR_STATS_ENABLE == 1)
+#define ISR_STATS_ENTER()             IsrStats_Enter()
+#define ISR_STATS_EXIT()              IsrStats_Exit()
+#else
+#define ISR_STATS_ENTER()
+#define ISR_STATS_EXIT()
+#endif
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    ISR_STATS_LATENCY,          /* Cycles from the interrupt request to the handler entry */
+    ISR_STATS_EXECUTION,        /* Cycles from the handler entry to its exit (higher priority handlers included) */
+    ISR_STATS_JITTER            /* Difference between two consecutive inter-arrival times in cycles */
+}IsrStats_MetricType;
+
+typedef struct
+{
+    uint32 Count;
+    uint32 Min;
+    uint32 Max;
+    uint32 Buckets[ISR_STATS_BUCKETS_COUNT];
+}IsrStats_HistogramType;
+
+/* Summary of a histogram, the percentiles are the upper limits of their buckets (limited to Max) */
+typedef struct
+{
+    uint32 Count;
+    uint32 Min;
+    uint32 Max;
+    uint32 Percentile50;
+    uint32 Percentile90;
+    uint32 Percentile99;
+}IsrStats_SummaryType;
+
+/* Output of IsrStats_Dump, called with one line at a time */
+typedef void (*IsrStats_PutStringType)(const char *a_String);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: IsrStats_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Clear all the statistics and release the slots. Must be called after Delay_Init
+*              (the DWT cycle counter is the time base) and before the interrupts are enabled.
+************************************************************************************/
+void IsrStats_Init(void);
+
+
+/************************************************************************************
+* Service Name: IsrStats_Enter
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record the entry of the active handler, the vector is read from the
+*              Interrupt Control and State register. The SysTick latency is measured from the
+*              counter re-load, the latency of the other vectors from the time recorded by
+*              IsrStats_MarkTrigger if any.
+************************************************************************************/
+void IsrStats_Enter(void);
+
+
+/************************************************************************************
+* Service Name: IsrStats_Exit
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record the exit of the active handler and its execution time.
+************************************************************************************/
+void IsrStats_Exit(void);
+
+
+/************************************************************************************
+* Service Name: IsrStats_MarkTrigger
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Vector - Vector number of the interrupt about to be requested
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record the time an interrupt is requested (before it is pended by software,
+*              or when the event time of a peripheral is known), its next entry records the latency.
+************************************************************************************/
+void IsrStats_MarkTrigger(uint8 a_Vector);
+
+
+/************************************************************************************
+* Service Name: IsrStats_GetSummary
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Vector - Vector number, 15 for SysTick and 16 + IRQ number for the interrupts
+*                , a_Metric - Histogram to summarize
+* Parameters (inout): None
+* Parameters (out): a_Summary - Count, minimum, maximum and percentiles in cycles
+* Return value: boolean - FALSE if the vector was never measured
+* Description: Function to summarize a histogram, can be called while the handler is active.
+************************************************************************************/
+boolean IsrStats_GetSummary(uint8 a_Vector, IsrStats_MetricType a_Metric, IsrStats_SummaryType *a_Summary);
+
+
+/************************************************************************************
+* Service Name: IsrStats_Reset
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the histograms, the slots stay assigned to their vectors.
+************************************************************************************/
+void IsrStats_Reset(void);
+
+
+/************************************************************************************
+* Service Name: IsrStats_Dump
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_PutString - Function writing one line of text
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to print the summary of every measured vector, one line per metric:
+*              "V<vector> <LAT|EXE|JIT> n=<count> min=<> p50=<> p90=<> p99=<> max=<>" in cycles.
+*              Must be called from thread mode, the formatting is slow.
+************************************************************************************/
+void IsrStats_Dump(IsrStats_PutStringType a_PutString);
+
+#endif /* ISRSTATS_H_ */
@@ -0,0 +1,88 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Line.c                                                                    *
+ * [DESCRIPTION]    :           Source file for the text line formatting of the reports                   *
+ * [DATE CREATED]   :           OCT 17, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Line.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Digits of the largest uint32 (4294967295) */
+#define LINE_NUMBER_MAX_DIGITS        10
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Line_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Buffer - Storage of the text
+ *                , a_Size - Size of the storage in bytes, at least 1
+ * Parameters (inout): a_Line - Line object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize an empty line on the given storage, also used to start the next line.
+ ************************************************************************************/
+void Line_Init(Line_Type *a_Line, char *a_Buffer, uint8 a_Size)
+{
+    a_Line->Buffer = a_Buffer;
+    a_Line->Size = a_Size;
+    a_Line->Length = 0;
+    a_Line->Buffer[0] = '\0';
+}
+
+
+/************************************************************************************
+ * Service Name: Line_AppendString
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_String - Null terminated string
+ * Parameters (inout): a_Line - Line object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to append a string to the line, the line is truncated if it is full.
+ ************************************************************************************/
+void Line_AppendString(Line_Type *a_Line, const char *a_String)
+{
+    while((*a_String != '\0') && (a_Line->Length < (a_Line->Size - 1)))
+    {
+        a_Line->Buffer[a_Line->Length] = *a_String;
+        a_Line->Length++;
+        a_String++;
+    }
+    a_Line->Buffer[a_Line->Length] = '\0';
+}
+
+
+/************************************************************************************
+ * Service Name: Line_AppendNumber
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Number - Unsigned number
+ * Parameters (inout): a_Line - Line object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to append a number in decimal to the line, the line is truncated if it
+ *              is full.
+ ************************************************************************************/
+void Line_AppendNumber(Line_Type *a_Line, uint32 a_Number)
+{
+    char Digits[LINE_NUMBER_MAX_DIGITS + 1];
+    uint8 Index = LINE_NUMBER_MAX_DIGITS;
+
+    /* The digits are written from the lowest one */
+    Digits[Index] = '\0';
+    do
+    {
+        Index--;
+        Digits[Index] = (char)('0' + (a_Number % 10));
+        a_Number /= 10;
+    }while(a_Number != 0);
+
+    Line_AppendString(a_Line, &Digits[Index]);
+}
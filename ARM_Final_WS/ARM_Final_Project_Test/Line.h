@@ -0,0 +1,68 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Line.h                                                                    *
+ * [DESCRIPTION]    :           Header file for the text line formatting of the reports                   *
+ * [DATE CREATED]   :           OCT 17, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef LINE_H_
+#define LINE_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Line object on a buffer of the caller ... the text is always null terminated, what does not fit
+ * in the buffer is dropped */
+typedef struct
+{
+    char  *Buffer;
+    uint8  Size;              /* Buffer size in bytes, the null included */
+    uint8  Length;            /* Characters in the line, the null excluded */
+}Line_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Line_Init
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Buffer - Storage of the text
+*                , a_Size - Size of the storage in bytes, at least 1
+* Parameters (inout): a_Line - Line object
+* Parameters (out): None
+* Return value: None
+* Description: Initialize an empty line on the given storage, also used to start the next line.
+************************************************************************************/
+void Line_Init(Line_Type *a_Line, char *a_Buffer, uint8 a_Size);
+
+
+/************************************************************************************
+* Service Name: Line_AppendString
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_String - Null terminated string
+* Parameters (inout): a_Line - Line object
+* Parameters (out): None
+* Return value: None
+* Description: Function to append a string to the line, the line is truncated if it is full.
+************************************************************************************/
+void Line_AppendString(Line_Type *a_Line, const char *a_String);
+
+
+/************************************************************************************
+* Service Name: Line_AppendNumber
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Number - Unsigned number
+* Parameters (inout): a_Line - Line object
+* Parameters (out): None
+* Return value: None
+* Description: Function to append a number in decimal to the line, the line is truncated if it
+*              is full.
+************************************************************************************/
+void Line_AppendNumber(Line_Type *a_Line, uint32 a_Number);
+
+#endif /* LINE_H_ */
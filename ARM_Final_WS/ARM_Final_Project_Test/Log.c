@@ -0,0 +1,198 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Log.c                                                                     *
+ * [DESCRIPTION]    :           Source file for the tokenized logger - formatted on the host              *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Log.h"
+#include "NVIC.h"
+#include "Uart0.h"
+#include "Power.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define LOG_RECORDS_MASK              (LOG_RECORDS_COUNT - 1)
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Any task or ISR is a producer, the idle task is the consumer */
+static Log_RecordType g_Log_Records[LOG_RECORDS_COUNT];
+
+/* Next index to reserve, and first index not sent yet */
+static volatile uint32 g_Log_Head = 0;
+static volatile uint32 g_Log_Tail = 0;
+
+/* Records given to Uart0_Write, released when the transfer is done */
+static uint32 g_Log_Sending = 0;
+
+static volatile uint32 g_Log_Dropped = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Store a_New in *a_Address if it still holds a_Expected ... LDREX/STREX in Log_Port.asm on the
+ * target, the simulator uses the compiler atomics */
+#ifdef HOST_SIMULATION
+static boolean Log_CompareAndSwap(volatile uint32 *a_Address, uint32 a_Expected, uint32 a_New)
+{
+    return __atomic_compare_exchange_n(a_Address, &a_Expected, a_New, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? TRUE : FALSE;
+}
+#else
+extern boolean Log_CompareAndSwap(volatile uint32 *a_Address, uint32 a_Expected, uint32 a_New);
+#endif
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Log_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize the records ring. Must be called before the first log, after Delay_Init
+ *              (timestamps) and Uart0_Init (output).
+ ************************************************************************************/
+void Log_Init(void)
+{
+    uint32 Index;
+
+    /* A slot is published when its sequence equals the index reserved for it, the initial
+     * sequences are the indexes of the previous lap */
+    for(Index = 0; Index < LOG_RECORDS_COUNT; Index++)
+    {
+        g_Log_Records[Index].Sequence = Index - LOG_RECORDS_COUNT;
+    }
+
+    g_Log_Head = 0;
+    g_Log_Tail = 0;
+    g_Log_Sending = 0;
+    g_Log_Dropped = 0;
+}
+
+
+/************************************************************************************
+ * Service Name: Log_Write
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Format - Format string placed in LOG_STRINGS_SECTION (use the LOGn macros)
+ *                , a_Count - Number of arguments
+ *                , a_Argument0 .. a_Argument3 - Raw arguments
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to add a record to the ring without formatting, the record is dropped and
+ *              counted if the ring is full. Can be called from tasks and ISRs of any priority.
+ ************************************************************************************/
+void Log_Write(const char *a_Format, uint32 a_Count, uint32 a_Argument0, uint32 a_Argument1,
+               uint32 a_Argument2, uint32 a_Argument3)
+{
+    Log_RecordType *Record;
+    uint32 Timestamp = DWT_CYCCNT_REG;
+    uint32 Index;
+    uint32 Dropped;
+
+    /* Reserve a slot without masking the interrupts, a preempting producer takes the next slot
+     * and the reservation is tried again */
+    do
+    {
+        Index = g_Log_Head;
+        if((Index - g_Log_Tail) >= LOG_RECORDS_COUNT)
+        {
+            do
+            {
+                Dropped = g_Log_Dropped;
+            }while(Log_CompareAndSwap(&g_Log_Dropped, Dropped, Dropped + 1) == FALSE);
+            return;
+        }
+    }while(Log_CompareAndSwap(&g_Log_Head, Index, Index + 1) == FALSE);
+
+    Record = &g_Log_Records[Index & LOG_RECORDS_MASK];
+    Record->Header = LOG_HEADER_SYNC | (a_Count << LOG_HEADER_ARGUMENTS_BITS_POS) |
+                     (((uint32)a_Format - LOG_STRINGS_BASE) & LOG_HEADER_ID_MASK);
+    Record->Timestamp = Timestamp;
+    Record->Arguments[0] = a_Argument0;
+    Record->Arguments[1] = a_Argument1;
+    Record->Arguments[2] = a_Argument2;
+    Record->Arguments[3] = a_Argument3;
+
+    /* The record must be complete before it is published */
+    Data_Memory_Barrier();
+    Record->Sequence = Index;
+}
+
+
+/************************************************************************************
+ * Service Name: Log_Flush
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to send the published records on UART0 by uDMA directly from the ring,
+ *              the records are released when the transfer is done. Installed as the idle hook,
+ *              Deep-Sleep is prevented until the transfer is done and the TX FIFO is empty.
+ ************************************************************************************/
+void Log_Flush(void)
+{
+    uint32 Tail = g_Log_Tail;
+    uint32 Count = 0;
+
+    if(g_Log_Sending != 0)
+    {
+        if(Uart0_IsTxBusy() == TRUE)
+        {
+            return;
+        }
+
+        /* Release the sent records to the producers */
+        Tail += g_Log_Sending;
+        g_Log_Tail = Tail;
+        g_Log_Sending = 0;
+    }
+
+    /* Published records up to the end of the ring, a record still being written stops the batch */
+    while((Count < (LOG_RECORDS_COUNT - (Tail & LOG_RECORDS_MASK))) &&
+          (g_Log_Records[(Tail + Count) & LOG_RECORDS_MASK].Sequence == (Tail + Count)))
+    {
+        Count++;
+    }
+
+    if(Count != 0)
+    {
+        /* The records must be read after their sequence */
+        Data_Memory_Barrier();
+        if(Uart0_Write((const uint8 *)&g_Log_Records[Tail & LOG_RECORDS_MASK], Count * sizeof(Log_RecordType)) == TRUE)
+        {
+            g_Log_Sending = Count;
+        }
+    }
+
+    /* The UART and the uDMA are gated in Deep-Sleep, the end of the transfer wakes up the idle task.
+     * The last bytes are still in the TX FIFO at the end of the uDMA transfer, the next tick retries */
+    Power_SetDeepSleepAllowed(((g_Log_Sending == 0) && (Uart0_IsTxDrained() == TRUE)) ? TRUE : FALSE);
+}
+
+
+/************************************************************************************
+ * Service Name: Log_GetDropped
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of records dropped because the ring was full
+ * Description: Function to get the number of lost records since Log_Init.
+ ************************************************************************************/
+uint32 Log_GetDropped(void)
+{
+    return g_Log_Dropped;
+}
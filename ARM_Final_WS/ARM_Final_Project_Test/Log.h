@@ -0,0 +1,115 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Log.h                                                                     *
+ * [DESCRIPTION]    :           Header file for the tokenized logger - formatted on the host              *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef LOG_H_
+#define LOG_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Records buffered until the idle task sends them, must be a power of 2 */
+#define LOG_RECORDS_COUNT             64
+#define LOG_MAX_ARGUMENTS             4
+
+/* The format strings are placed in a section that is not loaded on the target (tm4c123gh6pm.cmd),
+ * the ID of a format is its offset in the section. tools/log_decoder.py extracts the section from
+ * the .out file and decodes the records received on UART0 */
+#define LOG_STRINGS_SECTION           ".log_strings"
+#define LOG_STRINGS_BASE              0x60000000
+
+/* Record header: sync byte, number of arguments and format ID */
+#define LOG_HEADER_SYNC               0xA5000000
+#define LOG_HEADER_ARGUMENTS_BITS_POS 16
+#define LOG_HEADER_ID_MASK            0x0000FFFF
+
+/* Log a format and 0 to 4 integer arguments (%d %i %u %x %X %c), the format must be a string literal.
+ * Only the record is written (about 50 cycles), safe from any ISR */
+#define LOG_FORMAT(FORMAT)  \
+    static const char Log_Format[] __attribute__((section(LOG_STRINGS_SECTION))) = FORMAT
+
+#define LOG0(FORMAT)                  do { LOG_FORMAT(FORMAT); Log_Write(Log_Format, 0, 0, 0, 0, 0); } while(0)
+#define LOG1(FORMAT, A)               do { LOG_FORMAT(FORMAT); Log_Write(Log_Format, 1, (uint32)(A), 0, 0, 0); } while(0)
+#define LOG2(FORMAT, A, B)            do { LOG_FORMAT(FORMAT); Log_Write(Log_Format, 2, (uint32)(A), (uint32)(B), 0, 0); } while(0)
+#define LOG3(FORMAT, A, B, C)         do { LOG_FORMAT(FORMAT); Log_Write(Log_Format, 3, (uint32)(A), (uint32)(B), (uint32)(C), 0); } while(0)
+#define LOG4(FORMAT, A, B, C, D)      do { LOG_FORMAT(FORMAT); Log_Write(Log_Format, 4, (uint32)(A), (uint32)(B), (uint32)(C), (uint32)(D)); } while(0)
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Record as sent on UART0 (little endian words) */
+typedef struct
+{
+    volatile uint32 Sequence;               /* Index of the record, written last to publish it */
+    uint32 Header;
+    uint32 Timestamp;                       /* DWT cycle counter */
+    uint32 Arguments[LOG_MAX_ARGUMENTS];
+}Log_RecordType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Log_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize the records ring. Must be called before the first log, after Delay_Init
+*              (timestamps) and Uart0_Init (output).
+************************************************************************************/
+void Log_Init(void);
+
+
+/************************************************************************************
+* Service Name: Log_Write
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Format - Format string placed in LOG_STRINGS_SECTION (use the LOGn macros)
+*                , a_Count - Number of arguments
+*                , a_Argument0 .. a_Argument3 - Raw arguments
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to add a record to the ring without formatting, the record is dropped and
+*              counted if the ring is full. Can be called from tasks and ISRs of any priority.
+************************************************************************************/
+void Log_Write(const char *a_Format, uint32 a_Count, uint32 a_Argument0, uint32 a_Argument1,
+               uint32 a_Argument2, uint32 a_Argument3);
+
+
+/************************************************************************************
+* Service Name: Log_Flush
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to send the published records on UART0 by uDMA directly from the ring,
+*              the records are released when the transfer is done. Installed as the idle hook,
+*              Deep-Sleep is prevented until the transfer is done and the TX FIFO is empty.
+************************************************************************************/
+void Log_Flush(void);
+
+
+/************************************************************************************
+* Service Name: Log_GetDropped
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of records dropped because the ring was full
+* Description: Function to get the number of lost records since Log_Init.
+************************************************************************************/
+uint32 Log_GetDropped(void);
+
+#endif /* LOG_H_ */
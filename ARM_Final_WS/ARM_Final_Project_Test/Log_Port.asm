@@ -0,0 +1,40 @@
+;**********************************************************************************************************
+; [FILE NAME]      :           Log_Port.asm                                                               *
+; [DESCRIPTION]    :           Lock-free slot reservation of the tokenized logger                         *
+; [DATE CREATED]   :           OCT 17, 2026                                                               *
+; [AURTHOR]        :           Alaa Mekawi                                                                *
+;**********************************************************************************************************
+        .thumb
+        .text
+
+        .global Log_CompareAndSwap
+
+;************************************************************************************
+; Service Name: Log_CompareAndSwap
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): a_Expected - Value the word must hold (R1)
+;                , a_New - Value stored if it does (R2)
+; Parameters (inout): a_Address - Word updated (R0)
+; Parameters (out): None
+; Return value: boolean - FALSE if the word changed or the store was interrupted (R0)
+; Description: Function to store a_New in the word if it still holds a_Expected. The exception
+;              entry and return clear the exclusive monitor, so a producer preempted between
+;              the load and the store fails and tries again with the new value.
+;************************************************************************************
+Log_CompareAndSwap: .asmfunc
+        LDREX   R3, [R0]
+        CMP     R3, R1
+        BNE     Log_CompareAndSwap_Fail
+        STREX   R3, R2, [R0]
+        CBNZ    R3, Log_CompareAndSwap_Fail
+        MOVS    R0, #1
+        BX      LR
+
+Log_CompareAndSwap_Fail:
+        CLREX
+        MOVS    R0, #0
+        BX      LR
+        .endasmfunc
+
+        .end
@@ -0,0 +1,165 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           MPU.c                                                                     *
+ * [DESCRIPTION]    :           Source file for the memory protection unit driver - stack guard regions   *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "MPU.h"
+#include "NVIC.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Guard region not used yet ... written disabled so a stale region of a previous run is cleared */
+#define MPU_GUARD_UNUSED(INDEX)       { MPU_BASE_VALID | (MPU_GUARD_FIRST_REGION + (INDEX)), 0 }
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Start of the .stack section (main stack), defined by the linker */
+extern uint32 __stack[];
+
+static MPU_RegionType g_MPU_Guards[MPU_GUARDS_COUNT] =
+{
+    MPU_GUARD_UNUSED(0), MPU_GUARD_UNUSED(1), MPU_GUARD_UNUSED(2), MPU_GUARD_UNUSED(3)
+};
+static uint8 g_MPU_GuardsCount = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Write 4 regions to MPU_BASE/MPU_ATTR and the aliases BASE1-3/ATTR1-3, each base selects its region
+ * (VALID bit) so the 8 consecutive stores need no write to MPU_NUMBER */
+static void MPU_WriteBurst(const MPU_RegionType *a_Regions)
+{
+    MPU_BASE_REG = a_Regions[0].Base;
+    MPU_ATTR_REG = a_Regions[0].Attr;
+    MPU_BASE1_REG = a_Regions[1].Base;
+    MPU_ATTR1_REG = a_Regions[1].Attr;
+    MPU_BASE2_REG = a_Regions[2].Base;
+    MPU_ATTR2_REG = a_Regions[2].Attr;
+    MPU_BASE3_REG = a_Regions[3].Base;
+    MPU_ATTR3_REG = a_Regions[3].Attr;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: MPU_AddStackGuard
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Stack - Lowest address of the stack (the array of the stack)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if all the guard regions are used
+ * Description: Function to add a no-access region on the lowest 32 bytes of a stack, a push beyond
+ *              the end of the stack raises a MemManage fault. The region is written at once if the
+ *              MPU is enabled, else by MPU_Init.
+ ************************************************************************************/
+boolean MPU_AddStackGuard(const void *a_Stack)
+{
+    MPU_RegionType *Guard;
+    uint32 Base;
+
+    if(g_MPU_GuardsCount == MPU_GUARDS_COUNT)
+    {
+        return FALSE;
+    }
+
+    /* The region base is aligned on its size, round up so the guard stays inside the stack */
+    Base = ((uint32)a_Stack + (MPU_GUARD_SIZE - 1)) & MPU_BASE_ADDR_MASK;
+
+    Guard = &g_MPU_Guards[g_MPU_GuardsCount];
+    Guard->Base = Base | MPU_BASE_VALID | (MPU_GUARD_FIRST_REGION + g_MPU_GuardsCount);
+    Guard->Attr = MPU_ATTR_AP_NO_ACCESS | MPU_ATTR_XN | MPU_ATTR_SRAM |
+                  ((MPU_GUARD_SIZE_LOG2 - 1) << MPU_ATTR_SIZE_BITS_POS) | MPU_ATTR_ENABLE;
+    g_MPU_GuardsCount++;
+
+    if(MPU_CTRL_REG & MPU_CTRL_ENABLE)
+    {
+        MPU_ConfigureRegions(Guard, 1);
+    }
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: MPU_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Regions - Table of the application regions (0 to 3), can be NULL_PTR
+ *                , a_Count - Number of regions in the table
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the device has no MPU or the table is too long
+ * Description: Function to add the guard of the main stack (.stack section), write the application
+ *              and the guard regions then enable the MPU. The privileged code keeps the default
+ *              memory map outside the regions. Must be called after Fault_Init.
+ ************************************************************************************/
+boolean MPU_Init(const MPU_RegionType *a_Regions, uint8 a_Count)
+{
+    if((((MPU_TYPE_REG & MPU_TYPE_DREGION_MASK) >> MPU_TYPE_DREGION_BITS_POS) < MPU_REGIONS_COUNT) ||
+       (a_Count > MPU_APP_REGIONS_COUNT))
+    {
+        return FALSE;
+    }
+
+    /* The exceptions run on the main stack, its guard is taken by the push of the exception frame too */
+    MPU_AddStackGuard(__stack);
+
+    /* One burst for the whole guard table, the unused guards are cleared by the same burst */
+    MPU_ConfigureRegions(a_Regions, a_Count);
+    MPU_ConfigureRegions(g_MPU_Guards, MPU_GUARDS_COUNT);
+
+    MPU_CTRL_REG = MPU_CTRL_PRIVDEFENA | MPU_CTRL_ENABLE;
+    Data_Sync_Barrier();
+    Instruction_Sync_Barrier();
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: MPU_ConfigureRegions
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Regions - Table of regions built with MPU_REGION
+ *                , a_Count - Number of regions in the table
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to write a table of regions, 4 regions per burst on the aliases. The MPU
+ *              is disabled during the writes, the other regions are not changed.
+ ************************************************************************************/
+void MPU_ConfigureRegions(const MPU_RegionType *a_Regions, uint8 a_Count)
+{
+    uint32 Primask;
+    uint32 Ctrl;
+    uint8 Index;
+
+    /* A region is half written between its MPU_BASE and MPU_ATTR writes, no access can use it */
+    Primask = NVIC_DisableExceptionsSave();
+    Data_Memory_Barrier();
+    Ctrl = MPU_CTRL_REG;
+    MPU_CTRL_REG = 0;
+
+    /* MPU_BASE_VALID is set in every base, the region number is taken from the base value
+     * and MPU_NUMBER is never written */
+    for(Index = 0; (Index + MPU_BURST_REGIONS) <= a_Count; Index += MPU_BURST_REGIONS)
+    {
+        MPU_WriteBurst(&a_Regions[Index]);
+    }
+    for(; Index < a_Count; Index++)
+    {
+        MPU_BASE_REG = a_Regions[Index].Base;
+        MPU_ATTR_REG = a_Regions[Index].Attr;
+    }
+
+    MPU_CTRL_REG = Ctrl;
+    Data_Sync_Barrier();
+    Instruction_Sync_Barrier();
+    NVIC_RestoreExceptions(Primask);
+}
@@ -0,0 +1,119 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           MPU.h                                                                     *
+ * [DESCRIPTION]    :           Header file for the memory protection unit driver - stack guard regions   *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef MPU_H_
+#define MPU_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define MPU_REGIONS_COUNT             8
+
+/* Regions written by one burst: MPU_BASE/MPU_ATTR and the three aliases BASE1-3/ATTR1-3 */
+#define MPU_BURST_REGIONS             4
+
+/* The application regions are 0 to 3, the stack guards are 4 to 7 ... a higher region number
+ * has the priority when the regions overlap, so a guard wins over any application region */
+#define MPU_APP_REGIONS_COUNT         4
+#define MPU_GUARD_FIRST_REGION        4
+#define MPU_GUARDS_COUNT              (MPU_REGIONS_COUNT - MPU_GUARD_FIRST_REGION)
+
+/* Smallest region of the MPU, the guard covers the lowest 32 bytes of a stack. A stack not aligned
+ * on MPU_GUARD_SIZE loses up to 31 more bytes, the guard base is rounded up */
+#define MPU_GUARD_SIZE_LOG2           5
+#define MPU_GUARD_SIZE                (1UL << MPU_GUARD_SIZE_LOG2)
+
+/* MPU_TYPE, MPU_CTRL and MPU_BASE fields */
+#define MPU_TYPE_DREGION_BITS_POS     8
+#define MPU_TYPE_DREGION_MASK         0x0000FF00
+#define MPU_CTRL_ENABLE               0x00000001
+#define MPU_CTRL_PRIVDEFENA           0x00000004      /* Default memory map for the privileged accesses */
+#define MPU_BASE_ADDR_MASK            0xFFFFFFE0
+#define MPU_BASE_VALID                0x00000010      /* The region number of the write selects the region */
+#define MPU_BASE_REGION_MASK          0x0000000F
+
+/* MPU_ATTR fields ... access permissions (privileged/unprivileged), memory type and size */
+#define MPU_ATTR_XN                   0x10000000      /* Instruction fetches not allowed */
+#define MPU_ATTR_AP_NO_ACCESS         0x00000000
+#define MPU_ATTR_AP_PRIV_RW           0x01000000
+#define MPU_ATTR_AP_FULL_ACCESS       0x03000000
+#define MPU_ATTR_AP_PRIV_RO           0x05000000
+#define MPU_ATTR_AP_READ_ONLY         0x06000000
+#define MPU_ATTR_FLASH                0x00020000      /* Normal, cacheable, not shareable */
+#define MPU_ATTR_SRAM                 0x00060000      /* Normal, cacheable, shareable */
+#define MPU_ATTR_PERIPHERAL           0x00050000      /* Device, bufferable, shareable */
+#define MPU_ATTR_SIZE_BITS_POS        1
+#define MPU_ATTR_ENABLE               0x00000001
+
+/* Region of 2^SIZE_LOG2 bytes (5 to 32) at ADDRESS, which must be aligned on its size.
+ * ATTRIBUTES is the access permission ORed with the memory type and MPU_ATTR_XN */
+#define MPU_REGION(NUMBER, ADDRESS, SIZE_LOG2, ATTRIBUTES)                                        \
+    { ((uint32)(ADDRESS) & MPU_BASE_ADDR_MASK) | MPU_BASE_VALID | ((NUMBER) & MPU_BASE_REGION_MASK), \
+      (ATTRIBUTES) | ((uint32)((SIZE_LOG2) - 1) << MPU_ATTR_SIZE_BITS_POS) | MPU_ATTR_ENABLE }
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Values written to MPU_BASE and MPU_ATTR, a table of regions is written to the aliases in bursts
+ * so the layout of the structure must not change */
+typedef struct
+{
+    uint32 Base;        /* Address, MPU_BASE_VALID and the region number */
+    uint32 Attr;        /* Attributes, size and enable */
+}MPU_RegionType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: MPU_AddStackGuard
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Stack - Lowest address of the stack (the array of the stack)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if all the guard regions are used
+* Description: Function to add a no-access region on the lowest 32 bytes of a stack, a push beyond
+*              the end of the stack raises a MemManage fault. The region is written at once if the
+*              MPU is enabled, else by MPU_Init.
+************************************************************************************/
+boolean MPU_AddStackGuard(const void *a_Stack);
+
+
+/************************************************************************************
+* Service Name: MPU_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Regions - Table of the application regions (0 to 3), can be NULL_PTR
+*                , a_Count - Number of regions in the table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the device has no MPU or the table is too long
+* Description: Function to add the guard of the main stack (.stack section), write the application
+*              and the guard regions then enable the MPU. The privileged code keeps the default
+*              memory map outside the regions. Must be called after Fault_Init.
+************************************************************************************/
+boolean MPU_Init(const MPU_RegionType *a_Regions, uint8 a_Count);
+
+
+/************************************************************************************
+* Service Name: MPU_ConfigureRegions
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Regions - Table of regions built with MPU_REGION
+*                , a_Count - Number of regions in the table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write a table of regions, 4 regions per burst on the aliases. The MPU
+*              is disabled during the writes, the other regions are not changed.
+************************************************************************************/
+void MPU_ConfigureRegions(const MPU_RegionType *a_Regions, uint8 a_Count);
+
+#endif /* MPU_H_ */
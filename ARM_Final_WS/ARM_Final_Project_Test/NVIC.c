@@ -8,166 +8,13 @@
  *                                Inclusions                                   *
  *******************************************************************************/
 #include "NVIC.h"
-/* Array of pointers to NVIC priority registers*/
-static volatile uint32 *NVIC_PRIx_REG[NVIC_PRI_REG_COUNT] = {
-                                    &NVIC_PRI0_REG,
-                                    &NVIC_PRI1_REG,
-                                    &NVIC_PRI2_REG,
-                                    &NVIC_PRI3_REG,
-                                    &NVIC_PRI4_REG,
-                                    &NVIC_PRI5_REG,
-                                    &NVIC_PRI6_REG,
-                                    &NVIC_PRI7_REG,
-                                    &NVIC_PRI8_REG,
-                                    &NVIC_PRI9_REG,
-                                    &NVIC_PRI10_REG,
-                                    &NVIC_PRI11_REG,
-                                    &NVIC_PRI12_REG,
-                                    &NVIC_PRI13_REG,
-                                    &NVIC_PRI14_REG,
-                                    &NVIC_PRI15_REG,
-                                    &NVIC_PRI16_REG,
-                                    &NVIC_PRI17_REG,
-                                    &NVIC_PRI18_REG,
-                                    &NVIC_PRI19_REG,
-                                    &NVIC_PRI20_REG,
-                                    &NVIC_PRI21_REG,
-                                    &NVIC_PRI22_REG,
-                                    &NVIC_PRI23_REG,
-                                    &NVIC_PRI24_REG,
-                                    &NVIC_PRI25_REG,
-                                    &NVIC_PRI26_REG,
-                                    &NVIC_PRI27_REG,
-                                    &NVIC_PRI28_REG,
-                                    &NVIC_PRI29_REG,
-                                    &NVIC_PRI30_REG,
-                                    &NVIC_PRI31_REG,
-                                    &NVIC_PRI32_REG,
-                                    &NVIC_PRI33_REG,
-                                    &NVIC_PRI34_REG,
-};
 /*******************************************************************************
- *                      Functions Definitions - IRQ'S Functions                *
+ *                           Global Variables                                  *
  *******************************************************************************/
-/*********************************************************************
- * Service Name: NVIC_EnableIRQ
- * Sync/Async: Synchronous
- * Reentrancy: reentrant
- * Parameters (in): IRQ_Num - Number of the IRQ from the target vector table
- * Parameters (inout): None
- * Parameters (out): None
- * Return value: None
- * Description: Function to enable Interrupt request for specific IRQ
- **********************************************************************/
-void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num)
-{
-    /* Check If IRQ_Num is within valid Range */
-#if (IRQ_Num < 0 || IRQ_Num > 138)
-#error Invalid IRQ_Num!
-#endif
-
-
-    /* Calculate the Register and The Bit u want to Set*/
-    uint8 Enable_Register_Number = IRQ_Num / 32;
-    uint8 Bit_Number = IRQ_Num % 32;
-
-    /* Set the corresponding bit in the ENx register To Enable Interrupt Request*/
-    switch(Enable_Register_Number)
-    {
-    case 0:
-        NVIC_EN0_REG |= (1<<Bit_Number);
-        break;
-    case 1:
-        NVIC_EN1_REG |= (1<<Bit_Number);
-        break;
-    case 2:
-        NVIC_EN2_REG |= (1<<Bit_Number);
-        break;
-    case 3:
-        NVIC_EN3_REG |= (1<<Bit_Number);
-        break;
-    case 4:
-        NVIC_EN4_REG |= (1<<Bit_Number);
-        break;
-    }
-
-}
-
-/*********************************************************************
- * Service Name: NVIC_DisableIRQ
- * Sync/Async: Synchronous
- * Reentrancy: reentrant
- * Parameters (in): IRQ_Num - Number of the IRQ from the target vector table
- * Parameters (inout): None
- * Parameters (out): None
- * Return value: None
- * Description: Function to Disable Interrupt request for specific IRQ
- **********************************************************************/
-void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num)
-{
-    /* Check If IRQ_Num is within valid Range */
-#if (IRQ_Num < 0 || IRQ_Num > 138)
-#error Invalid IRQ_Num!
-#endif
-
-
-    /* Calculate the Register and The Bit u want to Set*/
-    uint8 Disable_Register_Number = IRQ_Num / 32;
-    uint8 Bit_Number = IRQ_Num % 32;
-
-    /* Set the corresponding bit in the ENx register To Enable Interrupt Request*/
-    switch(Disable_Register_Number)
-    {
-    case 0:
-        NVIC_DIS0_REG  |= (1<<Bit_Number);
-        break;
-    case 1:
-        NVIC_DIS1_REG  |= (1<<Bit_Number);
-        break;
-    case 2:
-        NVIC_DIS2_REG  |= (1<<Bit_Number);
-        break;
-    case 3:
-        NVIC_DIS3_REG  |= (1<<Bit_Number);
-        break;
-    case 4:
-        NVIC_DIS4_REG  |= (1<<Bit_Number);
-        break;
-    }
-
-}
-
-/*********************************************************************
- * Service Name: NVIC_SetPriorityIRQ
- * Sync/Async: Synchronous
- * Reentrancy: reentrant
- * Parameters (in): IRQ_Num - Number of the IRQ from the target vector table
- *                , IRQ_Priority - Priority of the IRQ
- * Parameters (inout): None
- * Parameters (out): None
- * Return value: None
- * Description: Function to Disable Interrupt request for specific IRQ
- **********************************************************************/
-void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority)
-{
-    /* Check If IRQ_Num and IRQ_Priority is within valid Range */
-#if (IRQ_Num < 0 || IRQ_Num > 138)
-#error Invalid IRQ_Num!
-#endif
-#if (IRQ_Priority < 0 || IRQ_Priority > 7)
-#error Invalid IRQ_Priority!
-#endif
-
-    /* Calculate the Register Number and The First Bit Number of the Three Priority Bits*/
-    uint8 Priority_Register_Number = IRQ_Num / 4;
-    uint8 Priority_Bit_Position =   (IRQ_Num % 4) * 8 + 5;
-
-    /* Clear The three Bits First before insert by shifting the value 7 "0b00000111" to the Priority_Bit_Position*/
-    *(NVIC_PRIx_REG[Priority_Register_Number]) &= ~(7 << Priority_Bit_Position);
-
-    /*Then Insert The Priority*/
-    *(NVIC_PRIx_REG[Priority_Register_Number]) |= (IRQ_Priority << Priority_Bit_Position);
-}
+/* Vector table in SRAM ... the linker command file places .vtable at 0x20000000, aligned for VTOR
+ * (the table size rounded up to a power of 2, 1024 bytes) */
+#pragma DATA_SECTION(g_NVIC_RamVectors, ".vtable")
+static NVIC_HandlerType g_NVIC_RamVectors[NVIC_VECTORS_COUNT];
 
 /*******************************************************************************
  *                      Functions Definitions - Exceptions Functions           *
@@ -185,10 +32,6 @@ void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority
  **********************************************************************/
 void NVIC_EnableException(NVIC_ExceptionType Exception_Num)
 {
-#if (Exception_Num > 9)
-#error Invalid NVIC_ExceptionType value!
-#endif
-
     switch (Exception_Num) {
 
     /* Enable memory fault exception */
@@ -206,6 +49,9 @@ void NVIC_EnableException(NVIC_ExceptionType Exception_Num)
         NVIC_SYSTEM_SYSHNDCTRL |= USAGE_FAULT_ENABLE_MASK;
         break;
 
+        /* The other exceptions are always enabled */
+    default:
+        break;
     }
 }
 
@@ -221,10 +67,6 @@ void NVIC_EnableException(NVIC_ExceptionType Exception_Num)
  **********************************************************************/
 void NVIC_DisableException(NVIC_ExceptionType Exception_Num)
 {
-#if (Exception_Num > 9)
-#error Invalid NVIC_ExceptionType value!
-#endif
-
     switch (Exception_Num) {
 
         /* Disable memory fault exception */
@@ -242,6 +84,9 @@ void NVIC_DisableException(NVIC_ExceptionType Exception_Num)
         NVIC_SYSTEM_SYSHNDCTRL &= ~USAGE_FAULT_ENABLE_MASK;
         break;
 
+        /* The other exceptions can't be disabled */
+    default:
+        break;
     }
 }
 
@@ -258,50 +103,189 @@ void NVIC_DisableException(NVIC_ExceptionType Exception_Num)
 void NVIC_SetPriorityException(NVIC_ExceptionType
                                Exception_Num, NVIC_ExceptionPriorityType Exception_Priority)
 {
-#if (Exception_Num < 0 || Exception_Num > 9)
-#error Invalid NVIC_ExceptionType value!
-#endif
-#if (Exception_Priority < 0 || Exception_Priority > 7)
-#error Invalid  Exception_Priority!
-#endif
-
     switch (Exception_Num) {
 
     /* Set the priority value For Memory fault exception */
     case EXCEPTION_MEM_FAULT_TYPE:
-        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG & MEM_FAULT_PRIORITY_MASK) | (Exception_Priority << MEM_FAULT_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG & ~MEM_FAULT_PRIORITY_MASK) | (Exception_Priority << MEM_FAULT_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value For Bus fault exception */
     case EXCEPTION_BUS_FAULT_TYPE:
-        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG &  BUS_FAULT_PRIORITY_MASK ) | (Exception_Priority << BUS_FAULT_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG &  ~BUS_FAULT_PRIORITY_MASK ) | (Exception_Priority << BUS_FAULT_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value For Usage fault exception */
     case EXCEPTION_USAGE_FAULT_TYPE:
-        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG &  USAGE_FAULT_PRIORITY_MASK ) | (Exception_Priority << USAGE_FAULT_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI1_REG = (NVIC_SYSTEM_PRI1_REG &  ~USAGE_FAULT_PRIORITY_MASK ) | (Exception_Priority << USAGE_FAULT_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value For SVC exception */
     case EXCEPTION_SVC_TYPE:
-        NVIC_SYSTEM_PRI2_REG = (NVIC_SYSTEM_PRI2_REG & SVC_PRIORITY_MASK) | (Exception_Priority << SVC_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI2_REG = (NVIC_SYSTEM_PRI2_REG & ~SVC_PRIORITY_MASK) | (Exception_Priority << SVC_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value For Debug Monitor exception */
     case EXCEPTION_DEBUG_MONITOR_TYPE:
-        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & DEBUG_MONITOR_PRIORITY_MASK) | (Exception_Priority << DEBUG_MONITOR_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & ~DEBUG_MONITOR_PRIORITY_MASK) | (Exception_Priority << DEBUG_MONITOR_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value Pend_SV exception */
     case EXCEPTION_PEND_SV_TYPE:
-        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG  &  PENDSV_PRIORITY_MASK) | (Exception_Priority << PENDSV_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG  &  ~PENDSV_PRIORITY_MASK) | (Exception_Priority << PENDSV_PRIORITY_BITS_POS);
         break;
 
         /* Set the priority value SysTick exception */
     case EXCEPTION_SYSTICK_TYPE:
-        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (Exception_Priority << SYSTICK_PRIORITY_BITS_POS);
+        NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & ~SYSTICK_PRIORITY_MASK) | (Exception_Priority << SYSTICK_PRIORITY_BITS_POS);
+        break;
+
+        /* Reset, NMI and Hard fault have a fixed priority */
+    default:
         break;
+    }
+}
+
+/*********************************************************************
+ * Service Name: NVIC_SetPriorityGrouping
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Group - Split of the priority bits in preemption priority and subpriority
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to set the PRIGROUP field, must be called before the interrupts are enabled.
+ **********************************************************************/
+void NVIC_SetPriorityGrouping(NVIC_PriorityGroupType a_Group)
+{
+    /* The write is ignored without the key, SYSRESREQ and VECTCLRACT are written 0 */
+    NVIC_SYSTEM_APINT = NVIC_APINT_VECTKEY | ((uint32)a_Group << NVIC_APINT_PRIGROUP_BITS_POS);
+}
+
+/*********************************************************************
+ * Service Name: NVIC_GetPriorityGrouping
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: NVIC_PriorityGroupType - Current split of the priority bits
+ * Description:  Function to get the PRIGROUP field, the reset value 0 reads as NVIC_PRIORITY_GROUP_3_0.
+ **********************************************************************/
+NVIC_PriorityGroupType NVIC_GetPriorityGrouping(void)
+{
+    uint32 Group = (NVIC_SYSTEM_APINT & NVIC_APINT_PRIGROUP_MASK) >> NVIC_APINT_PRIGROUP_BITS_POS;
+
+    /* PRIGROUP 0 .. 4 leave the 3 implemented bits in the preemption priority */
+    return (Group < NVIC_PRIORITY_GROUP_3_0) ? NVIC_PRIORITY_GROUP_3_0 : (NVIC_PriorityGroupType)Group;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions - Vector Table Functions         *
+ *******************************************************************************/
+
+/*********************************************************************
+ * Service Name: NVIC_InitVectorTable
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to copy the vector table pointed by VTOR (the flash table after reset) to
+ *               the .vtable section in SRAM and point VTOR at the copy. Does nothing if VTOR already
+ *               points at the SRAM table.
+ **********************************************************************/
+void NVIC_InitVectorTable(void)
+{
+    const NVIC_HandlerType *Vectors = (const NVIC_HandlerType *)NVIC_SYSTEM_VTABLE;
+    uint32 Primask;
+    uint32 Vector;
+
+    if(Vectors == g_NVIC_RamVectors)
+    {
+        return;
+    }
+
+    /* No exception can be taken while VTOR changes */
+    Primask = NVIC_DisableExceptionsSave();
 
+    for(Vector = 0; Vector < NVIC_VECTORS_COUNT; Vector++)
+    {
+        g_NVIC_RamVectors[Vector] = Vectors[Vector];
     }
+
+    /* The copy is complete before the processor can fetch a vector from it */
+    Data_Sync_Barrier();
+    NVIC_SYSTEM_VTABLE = (uint32)g_NVIC_RamVectors;
+    Data_Sync_Barrier();
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+/*********************************************************************
+ * Service Name: NVIC_RegisterHandler
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Vector - Exception number (NVIC_SYSTICK_VECTOR, NVIC_IRQ_VECTOR(IRQ_Num) ...)
+ *                , a_Handler - Handler called by the processor for this exception
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: NVIC_HandlerType - The handler replaced by a_Handler
+ * Description:  Function to set the handler of an exception in the SRAM vector table, the table is
+ *               relocated first if needed. The handler is taken from the next exception entry.
+ **********************************************************************/
+NVIC_HandlerType NVIC_RegisterHandler(NVIC_VectorType a_Vector, NVIC_HandlerType a_Handler)
+{
+    NVIC_HandlerType Previous;
+
+    NVIC_InitVectorTable();
+
+    /* One word store ... an exception entry reads the old or the new handler, never a mix */
+    Previous = g_NVIC_RamVectors[a_Vector];
+    g_NVIC_RamVectors[a_Vector] = a_Handler;
+    Data_Sync_Barrier();
+
+    return Previous;
 }
 
+/*******************************************************************************
+ *                      Functions Definitions - PRIMASK Functions              *
+ *******************************************************************************/
+
+/* The target versions read and write PRIMASK in NVIC_Port.asm, a C function cannot return from
+ * inline assembly without unbalancing its own frame. The simulator models PRIMASK */
+#ifdef HOST_SIMULATION
+uint32 NVIC_DisableExceptionsSave(void)
+{
+    uint32 Primask = Sim_GetPrimask();
+
+    Sim_SetPrimask(1);
+    return Primask;
+}
+
+void NVIC_RestoreExceptions(uint32 a_Primask)
+{
+    Sim_SetPrimask(a_Primask);
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions Definitions - BASEPRI Functions              *
+ *******************************************************************************/
+
+/* The target versions read and write BASEPRI in NVIC_Port.asm, the simulator models BASEPRI */
+#ifdef HOST_SIMULATION
+uint32 NVIC_RaisePriorityCeiling(NVIC_IRQPriorityType a_Ceiling)
+{
+    uint32 Basepri = Sim_GetBasepri();
+
+    Sim_SetBasepriMax((uint32)a_Ceiling << NVIC_IRQ_PRIORITY_BITS_POS);
+    return Basepri;
+}
+
+void NVIC_RestorePriorityCeiling(uint32 a_Basepri)
+{
+    Sim_SetBasepri(a_Basepri);
+}
+#endif
@@ -16,6 +16,18 @@
  *******************************************************************************/
 #define NVIC_PRI_REG_COUNT 35
 
+/* IRQ 0 .. 138 of the target vector table, held in 5 enable/disable registers */
+#define NVIC_IRQ_MAX                         138
+#define NVIC_IRQ_REG_COUNT                   5
+#define NVIC_IRQ_PRIORITY_MAX                7
+
+/* Only the 3 upper bits of each priority byte are implemented */
+#define NVIC_IRQ_PRIORITY_BITS_POS           5
+
+/* Compile-time range check ... fails to compile when VALUE is a constant above MAX, a value only
+ * known at run time is not checked */
+#define NVIC_CHECK_RANGE(VALUE, MAX)         ((void)sizeof(char[(__builtin_constant_p(VALUE) && ((uint32)(VALUE) > (MAX))) ? -1 : 1]))
+
 #define MEM_FAULT_PRIORITY_MASK              0x000000E0
 #define MEM_FAULT_PRIORITY_BITS_POS          5
 
@@ -42,7 +54,32 @@
 #define USAGE_FAULT_ENABLE_MASK              0x00040000
 #define PENDSV_PEND_BIT_MASK                 0x10000000
 #define PENDSV_UNPEND_BIT_MASK               0x08000000
+#define SYSTICK_PEND_BIT_MASK                0x04000000
+#define SYSTICK_UNPEND_BIT_MASK              0x02000000
+
+/* Vector table ... the 16 system exceptions then the IRQs, the exception number is the index */
+#define NVIC_VECTORS_COUNT                   155
+#define NVIC_PENDSV_VECTOR                   14
+#define NVIC_SYSTICK_VECTOR                  15
+#define NVIC_IRQ_VECTOR(IRQ_NUM)             ((IRQ_NUM) + 16)
 
+/* APINT is written only with the VECTKEY, PRIGROUP selects the split of the priority bits */
+#define NVIC_APINT_VECTKEY                   0x05FA0000
+#define NVIC_APINT_PRIGROUP_MASK             0x00000700
+#define NVIC_APINT_PRIGROUP_BITS_POS         8
+#define NVIC_APINT_SYSRESREQ                 0x00000004
+
+#ifdef HOST_SIMULATION
+/* Host build ... the core instructions are executed by the simulation (ARM_Final_Project_Sim) */
+#define Enable_Exceptions()         Sim_SetPrimask(0)
+#define Disable_Exceptions()        Sim_SetPrimask(1)
+#define Enable_Faults()             Sim_SetFaultmask(0)
+#define Disable_Faults()            Sim_SetFaultmask(1)
+#define Wait_For_Interrupt()        Sim_WaitForInterrupt()
+#define Data_Sync_Barrier()         Sim_Barrier()
+#define Instruction_Sync_Barrier()  Sim_Barrier()
+#define Data_Memory_Barrier()       Sim_Barrier()
+#else
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -55,11 +92,29 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
+/* Wait For Interrupt ... This Macro puts the processor in Sleep/Deep-Sleep mode until an interrupt is pending,
+ * it wakes up even if the interrupt is masked by PRIMASK */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+/* Data Synchronization Barrier ... completes all outstanding memory accesses before the next instruction */
+#define Data_Sync_Barrier()    __asm(" DSB ")
+
+/* Instruction Synchronization Barrier ... flushes the pipeline so the next instruction sees the new context */
+#define Instruction_Sync_Barrier()  __asm(" ISB ")
+
+/* Data Memory Barrier ... orders the memory accesses before it with the memory accesses after it */
+#define Data_Memory_Barrier()  __asm(" DMB ")
+#endif
+
 /*******************************************************************************
  *                           Data Types Declarations                           *
  *******************************************************************************/
 typedef uint8 NVIC_IRQType;
 
+typedef uint8 NVIC_VectorType;
+
+typedef void (*NVIC_HandlerType)(void);
+
 typedef uint8 NVIC_IRQPriorityType;
 
 typedef enum
@@ -78,9 +133,23 @@ typedef enum
 
 typedef uint8 NVIC_ExceptionPriorityType;
 
+/* Split of the 3 implemented priority bits in preemption priority and subpriority, the value is the
+ * PRIGROUP field. Only the preemption priority decides if an exception preempts another one or is
+ * masked by BASEPRI, the subpriority orders the pending exceptions of the same preemption priority */
+typedef enum
+{
+    NVIC_PRIORITY_GROUP_3_0 = 4,        /* 8 preemption priorities, no subpriority (reset) */
+    NVIC_PRIORITY_GROUP_2_1 = 5,        /* 4 preemption priorities, 2 subpriorities */
+    NVIC_PRIORITY_GROUP_1_2 = 6,        /* 2 preemption priorities, 4 subpriorities */
+    NVIC_PRIORITY_GROUP_0_3 = 7         /* No preemption between IRQs, 8 subpriorities */
+}NVIC_PriorityGroupType;
+
 /*******************************************************************************
- *                      Functions Prototypes - IRQ'S Functions                 *
+ *                      Inline Functions - IRQ'S Functions                     *
  *******************************************************************************/
+/* The ENn/DISn registers are write-1 to set/clear, one store leaves the other IRQs unchanged. The
+ * functions are shadowed by macros with the same names that add the compile-time checks */
+
 /*********************************************************************
  * Service Name: NVIC_EnableIRQ
  * Sync/Async: Synchronous
@@ -91,7 +160,10 @@ typedef uint8 NVIC_ExceptionPriorityType;
  * Return value: None
  * Description: Function to enable Interrupt request for specific IRQ
 **********************************************************************/
-void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num);
+static inline void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num)
+{
+    NVIC_EN_REG(IRQ_Num / 32) = (1UL << (IRQ_Num % 32));
+}
 
 /*********************************************************************
  * Service Name: NVIC_DisableIRQ
@@ -103,7 +175,10 @@ void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num);
  * Return value: None
  * Description: Function to Disable Interrupt request for specific IRQ
 **********************************************************************/
-void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num);
+static inline void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num)
+{
+    NVIC_DIS_REG(IRQ_Num / 32) = (1UL << (IRQ_Num % 32));
+}
 
 /*********************************************************************
  * Service Name: NVIC_SetPriorityIRQ
@@ -114,9 +189,94 @@ void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num);
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Disable Interrupt request for specific IRQ
+ * Description: Function to set the priority of specific IRQ, the priority byte of the IRQ is
+ *              written alone so no read-modify-write is needed
+**********************************************************************/
+static inline void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority)
+{
+    NVIC_PRI_BYTE_REG(IRQ_Num) = (uint8)(IRQ_Priority << NVIC_IRQ_PRIORITY_BITS_POS);
+}
+
+/*********************************************************************
+ * Service Name: NVIC_EnableIRQMask
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Register_Num - Number of the ENn register (IRQ_Num / 32)
+ *                , IRQ_Mask - Bit (IRQ_Num % 32) set for each IRQ to enable
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to enable up to 32 IRQs with one store
+**********************************************************************/
+static inline void NVIC_EnableIRQMask(uint8 Register_Num, uint32 IRQ_Mask)
+{
+    NVIC_EN_REG(Register_Num) = IRQ_Mask;
+}
+
+/*********************************************************************
+ * Service Name: NVIC_DisableIRQMask
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Register_Num - Number of the DISn register (IRQ_Num / 32)
+ *                , IRQ_Mask - Bit (IRQ_Num % 32) set for each IRQ to disable
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to disable up to 32 IRQs with one store
 **********************************************************************/
-void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority);
+static inline void NVIC_DisableIRQMask(uint8 Register_Num, uint32 IRQ_Mask)
+{
+    NVIC_DIS_REG(Register_Num) = IRQ_Mask;
+}
+
+/*********************************************************************
+ * Service Name: NVIC_IsPendingIRQ
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): IRQ_Num - Number of the IRQ from the target vector table
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if the IRQ is pending, disabled or not
+ * Description: Function to read the pending state of specific IRQ, a disabled IRQ is still
+ *              pended by its request
+**********************************************************************/
+static inline boolean NVIC_IsPendingIRQ(NVIC_IRQType IRQ_Num)
+{
+    return (NVIC_PEND_REG(IRQ_Num / 32) & (1UL << (IRQ_Num % 32))) ? TRUE : FALSE;
+}
+
+/*********************************************************************
+ * Service Name: NVIC_ClearPendingIRQ
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): IRQ_Num - Number of the IRQ from the target vector table
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to clear the pending state of specific IRQ, a level request still
+ *              asserted by the peripheral pends it again
+**********************************************************************/
+static inline void NVIC_ClearPendingIRQ(NVIC_IRQType IRQ_Num)
+{
+    NVIC_UNPEND_REG(IRQ_Num / 32) = (1UL << (IRQ_Num % 32));
+}
+
+/* Range checks of the constant arguments, the parentheses around the names call the functions */
+#define NVIC_EnableIRQ(IRQ_NUM) \
+    (NVIC_CHECK_RANGE(IRQ_NUM, NVIC_IRQ_MAX), (NVIC_EnableIRQ)(IRQ_NUM))
+#define NVIC_DisableIRQ(IRQ_NUM) \
+    (NVIC_CHECK_RANGE(IRQ_NUM, NVIC_IRQ_MAX), (NVIC_DisableIRQ)(IRQ_NUM))
+#define NVIC_IsPendingIRQ(IRQ_NUM) \
+    (NVIC_CHECK_RANGE(IRQ_NUM, NVIC_IRQ_MAX), (NVIC_IsPendingIRQ)(IRQ_NUM))
+#define NVIC_ClearPendingIRQ(IRQ_NUM) \
+    (NVIC_CHECK_RANGE(IRQ_NUM, NVIC_IRQ_MAX), (NVIC_ClearPendingIRQ)(IRQ_NUM))
+#define NVIC_SetPriorityIRQ(IRQ_NUM, IRQ_PRIORITY) \
+    (NVIC_CHECK_RANGE(IRQ_NUM, NVIC_IRQ_MAX), NVIC_CHECK_RANGE(IRQ_PRIORITY, NVIC_IRQ_PRIORITY_MAX), \
+     (NVIC_SetPriorityIRQ)(IRQ_NUM, IRQ_PRIORITY))
+#define NVIC_EnableIRQMask(REGISTER_NUM, IRQ_MASK) \
+    (NVIC_CHECK_RANGE(REGISTER_NUM, NVIC_IRQ_REG_COUNT - 1), (NVIC_EnableIRQMask)(REGISTER_NUM, IRQ_MASK))
+#define NVIC_DisableIRQMask(REGISTER_NUM, IRQ_MASK) \
+    (NVIC_CHECK_RANGE(REGISTER_NUM, NVIC_IRQ_REG_COUNT - 1), (NVIC_DisableIRQMask)(REGISTER_NUM, IRQ_MASK))
 
 
 /*******************************************************************************
@@ -159,6 +319,122 @@ void NVIC_DisableException(NVIC_ExceptionType Exception_Num);
 **********************************************************************/
 void NVIC_SetPriorityException(NVIC_ExceptionType
                                Exception_Num, NVIC_ExceptionPriorityType Exception_Priority);
+
+/*********************************************************************
+ * Service Name: NVIC_SetPriorityGrouping
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Group - Split of the priority bits in preemption priority and subpriority
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to set the PRIGROUP field, must be called before the interrupts are enabled.
+**********************************************************************/
+void NVIC_SetPriorityGrouping(NVIC_PriorityGroupType a_Group);
+
+/*********************************************************************
+ * Service Name: NVIC_GetPriorityGrouping
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: NVIC_PriorityGroupType - Current split of the priority bits
+ * Description:  Function to get the PRIGROUP field, the reset value 0 reads as NVIC_PRIORITY_GROUP_3_0.
+**********************************************************************/
+NVIC_PriorityGroupType NVIC_GetPriorityGrouping(void);
+
+/*******************************************************************************
+ *                      Functions Prototypes - Vector Table Functions          *
+ *******************************************************************************/
+
+/*********************************************************************
+ * Service Name: NVIC_InitVectorTable
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to copy the vector table pointed by VTOR (the flash table after reset) to
+ *               the .vtable section in SRAM and point VTOR at the copy. Does nothing if VTOR already
+ *               points at the SRAM table.
+**********************************************************************/
+void NVIC_InitVectorTable(void);
+
+/*********************************************************************
+ * Service Name: NVIC_RegisterHandler
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Vector - Exception number (NVIC_SYSTICK_VECTOR, NVIC_IRQ_VECTOR(IRQ_Num) ...)
+ *                , a_Handler - Handler called by the processor for this exception
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: NVIC_HandlerType - The handler replaced by a_Handler
+ * Description:  Function to set the handler of an exception in the SRAM vector table, the table is
+ *               relocated first if needed. The handler is taken from the next exception entry.
+**********************************************************************/
+NVIC_HandlerType NVIC_RegisterHandler(NVIC_VectorType a_Vector, NVIC_HandlerType a_Handler);
+
+/*******************************************************************************
+ *                      Functions Prototypes - PRIMASK Functions               *
+ *******************************************************************************/
+
+/*********************************************************************
+ * Service Name: NVIC_DisableExceptionsSave
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - The PRIMASK value before disabling the exceptions
+ * Description:  Function to disable IRQ interrupts and Programmable Systems Exceptions and return
+ *               the previous state, so critical sections can be nested.
+**********************************************************************/
+uint32 NVIC_DisableExceptionsSave(void);
+
+/*********************************************************************
+ * Service Name: NVIC_RestoreExceptions
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Primask - PRIMASK value returned by NVIC_DisableExceptionsSave
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to restore the PRIMASK state saved by NVIC_DisableExceptionsSave.
+**********************************************************************/
+void NVIC_RestoreExceptions(uint32 a_Primask);
+
+/*******************************************************************************
+ *                      Functions Prototypes - BASEPRI Functions               *
+ *******************************************************************************/
+
+/*********************************************************************
+ * Service Name: NVIC_RaisePriorityCeiling
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Ceiling - Highest priority (lowest value, 1 .. 7) of the masked exceptions
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - The BASEPRI value before raising the ceiling
+ * Description:  Function to mask the exceptions with a preemption priority value of a_Ceiling or
+ *               more, the exceptions of higher priority keep their latency. The masking level is
+ *               only raised (BASEPRI_MAX) so nested sections with a lower ceiling keep the outer one.
+ *               Priority 0 can't be masked by BASEPRI, use NVIC_DisableExceptionsSave instead.
+**********************************************************************/
+uint32 NVIC_RaisePriorityCeiling(NVIC_IRQPriorityType a_Ceiling);
+
+/*********************************************************************
+ * Service Name: NVIC_RestorePriorityCeiling
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Basepri - BASEPRI value returned by NVIC_RaisePriorityCeiling
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Function to restore the BASEPRI state saved by NVIC_RaisePriorityCeiling.
+**********************************************************************/
+void NVIC_RestorePriorityCeiling(uint32 a_Basepri);
 /************************************************************************************
  *                                 End of File                                      *
  ************************************************************************************/
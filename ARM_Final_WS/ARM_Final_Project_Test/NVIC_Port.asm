@@ -0,0 +1,84 @@
+;**********************************************************************************************************
+; [FILE NAME]      :           NVIC_Port.asm                                                              *
+; [DESCRIPTION]    :           Exception masking registers (PRIMASK, BASEPRI) of the NVIC driver          *
+; [DATE CREATED]   :           OCT 17, 2026                                                               *
+; [AURTHOR]        :           Alaa Mekawi                                                                *
+;**********************************************************************************************************
+        .thumb
+        .text
+
+        .global NVIC_DisableExceptionsSave
+        .global NVIC_RestoreExceptions
+        .global NVIC_RaisePriorityCeiling
+        .global NVIC_RestorePriorityCeiling
+
+;************************************************************************************
+; Service Name: NVIC_DisableExceptionsSave
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): None
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: uint32 - The PRIMASK value before disabling the exceptions (R0)
+; Description: Function to disable IRQ interrupts and Programmable Systems Exceptions and return
+;              the previous state, so critical sections can be nested.
+;************************************************************************************
+NVIC_DisableExceptionsSave: .asmfunc
+        MRS     R0, PRIMASK
+        CPSID   I
+        BX      LR
+        .endasmfunc
+
+;************************************************************************************
+; Service Name: NVIC_RestoreExceptions
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): a_Primask - PRIMASK value returned by NVIC_DisableExceptionsSave (R0)
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: None
+; Description: Function to restore the PRIMASK state saved by NVIC_DisableExceptionsSave.
+;************************************************************************************
+NVIC_RestoreExceptions: .asmfunc
+        MSR     PRIMASK, R0
+        BX      LR
+        .endasmfunc
+
+;************************************************************************************
+; Service Name: NVIC_RaisePriorityCeiling
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): a_Ceiling - Highest priority (lowest value, 1 .. 7) of the masked exceptions (R0)
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: uint32 - The BASEPRI value before raising the ceiling (R0)
+; Description: Function to mask the exceptions with a preemption priority value of a_Ceiling or
+;              more, the exceptions of higher priority keep their latency. The masking level is
+;              only raised (BASEPRI_MAX) so nested sections with a lower ceiling keep the outer one.
+;************************************************************************************
+NVIC_RaisePriorityCeiling: .asmfunc
+        ; The priority is in the 3 upper bits of BASEPRI
+        LSL     R1, R0, #5
+        MRS     R0, BASEPRI
+        MSR     BASEPRI_MAX, R1
+        ; The next instruction runs with the new level
+        ISB
+        BX      LR
+        .endasmfunc
+
+;************************************************************************************
+; Service Name: NVIC_RestorePriorityCeiling
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): a_Basepri - BASEPRI value returned by NVIC_RaisePriorityCeiling (R0)
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: None
+; Description: Function to restore the BASEPRI state saved by NVIC_RaisePriorityCeiling.
+;************************************************************************************
+NVIC_RestorePriorityCeiling: .asmfunc
+        MSR     BASEPRI, R0
+        BX      LR
+        .endasmfunc
+
+        .end
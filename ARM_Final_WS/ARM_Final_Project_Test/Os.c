@@ -0,0 +1,381 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Os.c                                                                      *
+ * [DESCRIPTION]    :           Source file for the preemptive fixed-priority kernel                      *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Os.h"
+#include "SysTick.h"
+#include "NVIC.h"
+#include "MPU.h"
+#include "Stack.h"
+#include "Deferred.h"
+#include "common_macros.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Priority P is bit (31 - P) of the ready bitmap, so CLZ of the bitmap is the highest ready priority */
+#define OS_PRIORITY_BIT(PRIORITY)         (0x80000000UL >> (PRIORITY))
+
+/* Initial context of a task: R4-R11 and EXC_RETURN saved by PendSV, then the exception frame */
+#define OS_INITIAL_CONTEXT_WORDS          17
+#define OS_INITIAL_EXC_RETURN             0xFFFFFFFD      /* Thread mode, PSP, no FPU state */
+#define OS_INITIAL_XPSR                   0x01000000      /* Thumb state */
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Running task and the task to be switched to, used by PendSV_Handler (Os_Port.asm) */
+Os_TaskType *volatile g_Os_CurrentTask = NULL_PTR;
+Os_TaskType *volatile g_Os_NextTask = NULL_PTR;
+
+/* One bit per ready priority, the idle task is always ready */
+static volatile uint32 g_Os_ReadyBitmap = 0;
+
+static Os_TaskType *g_Os_Tasks[OS_PRIORITIES_COUNT];
+
+static volatile boolean g_Os_Started = FALSE;
+
+static Os_TaskType g_Os_IdleTask;
+#pragma DATA_ALIGN(g_Os_IdleStack, MPU_GUARD_SIZE)
+static uint32 g_Os_IdleStack[OS_IDLE_STACK_WORDS];
+static Os_IdleHookType volatile g_Os_IdleHook = NULL_PTR;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Select the highest priority ready task and pend PendSV if it is not the running one ...
+ * must be called inside a critical section */
+static void Os_Schedule(void)
+{
+    g_Os_NextTask = g_Os_Tasks[COUNT_LEADING_ZEROS(g_Os_ReadyBitmap)];
+
+    if((g_Os_Started == TRUE) && (g_Os_NextTask != g_Os_CurrentTask))
+    {
+        NVIC_SYSTEM_INTCTRL = PENDSV_PEND_BIT_MASK;
+    }
+}
+
+/* Make a blocked task ready ... must be called inside a critical section */
+static void Os_MakeReady(Os_TaskType *a_Task)
+{
+    a_Task->State = OS_TASK_READY;
+    g_Os_ReadyBitmap |= OS_PRIORITY_BIT(a_Task->Priority);
+    Os_Schedule();
+}
+
+/* Task timer call back - runs from SysTick when a delay or a wait timeout elapsed */
+static void Os_TimerCallBack(void *a_Context)
+{
+    uint32 Primask = NVIC_DisableExceptionsSave();
+
+    if(((Os_TaskType *)a_Context)->State != OS_TASK_READY)
+    {
+        Os_MakeReady((Os_TaskType *)a_Context);
+    }
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+/* Return address of the task functions ... a task returning from its function is deleted */
+static void Os_TaskExit(void)
+{
+    Disable_Exceptions();
+
+    g_Os_ReadyBitmap &= ~OS_PRIORITY_BIT(g_Os_CurrentTask->Priority);
+    g_Os_Tasks[g_Os_CurrentTask->Priority] = NULL_PTR;
+    Os_Schedule();
+
+    Enable_Exceptions();
+
+    /* Never reached, the context of this task is dropped by the switch */
+    while(1);
+}
+
+/* Idle task - sleeps until the next timer expiry when no other task is ready */
+static void Os_IdleTask(void *a_Argument)
+{
+    while(1)
+    {
+        if(g_Os_IdleHook != NULL_PTR)
+        {
+            g_Os_IdleHook();
+        }
+
+        /* The next expiry is read with the interrupts disabled so a timer started by an ISR is never missed,
+         * a pending switch wakes up the processor immediately */
+        Disable_Exceptions();
+        SysTick_SleepUntil(SwTimer_GetNextExpiry());
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Os_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize the kernel and its deferred work queue, create the idle task and set the
+ *              PendSV and SysTick priorities. Must be called after SysTick_Init and SwTimer_Init.
+ *              No work can be posted before.
+ ************************************************************************************/
+void Os_Init(void)
+{
+    uint8 Priority;
+
+    for(Priority = 0; Priority < OS_PRIORITIES_COUNT; Priority++)
+    {
+        g_Os_Tasks[Priority] = NULL_PTR;
+    }
+    g_Os_ReadyBitmap = 0;
+    g_Os_CurrentTask = NULL_PTR;
+    g_Os_Started = FALSE;
+
+    /* Bottom halves posted by the ISRs, drained by PendSV before the context switch */
+    Deferred_Init();
+
+    /* PendSV must be the lowest priority so a switch never happens in the middle of an ISR */
+    NVIC_SetPriorityException(EXCEPTION_PEND_SV_TYPE, OS_PENDSV_PRIORITY);
+    NVIC_SetPriorityException(EXCEPTION_SYSTICK_TYPE, OS_SYSTICK_PRIORITY);
+
+    Os_CreateTask(&g_Os_IdleTask, Os_IdleTask, NULL_PTR, g_Os_IdleStack, OS_IDLE_STACK_WORDS, OS_IDLE_TASK_PRIORITY);
+}
+
+
+/************************************************************************************
+ * Service Name: Os_CreateTask
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Entry - Task function, the task is deleted if it returns
+ *                , a_Argument - Argument passed to the task function
+ *                , a_Stack - Stack of the task, aligned on MPU_GUARD_SIZE (its lowest 32 bytes
+ *                            are the no-access guard region)
+ *                , a_StackWords - Size of the stack in words (at least OS_MIN_STACK_WORDS)
+ *                , a_Priority - Priority of the task (0 is the highest), one task per priority
+ * Parameters (inout): a_Task - Task object
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the priority is used or the stack is too small
+ * Description: Function to create a ready task, can be called before or after Os_Start.
+ ************************************************************************************/
+boolean Os_CreateTask(Os_TaskType *a_Task, Os_TaskEntryType a_Entry, void *a_Argument,
+                      uint32 *a_Stack, uint32 a_StackWords, uint8 a_Priority)
+{
+    uint32 *Stack_Pointer;
+    uint32 Primask;
+
+    if((a_Priority >= OS_PRIORITIES_COUNT) || (g_Os_Tasks[a_Priority] != NULL_PTR) || (a_StackWords < OS_MIN_STACK_WORDS))
+    {
+        return FALSE;
+    }
+
+    /* Painted before the initial context is written, for the high-water mark */
+    a_Task->StackIndex = Stack_Register(a_Stack, a_StackWords);
+
+    /* The exception frame must be 8-byte aligned */
+    Stack_Pointer = (uint32 *)((uint32)&a_Stack[a_StackWords] & ~0x7UL);
+    Stack_Pointer -= OS_INITIAL_CONTEXT_WORDS;
+
+    /* R4-R11 */
+    Stack_Pointer[0] = 0;
+    Stack_Pointer[1] = 0;
+    Stack_Pointer[2] = 0;
+    Stack_Pointer[3] = 0;
+    Stack_Pointer[4] = 0;
+    Stack_Pointer[5] = 0;
+    Stack_Pointer[6] = 0;
+    Stack_Pointer[7] = 0;
+    Stack_Pointer[8] = OS_INITIAL_EXC_RETURN;
+
+    /* Exception frame: R0-R3, R12, LR, PC and xPSR */
+    Stack_Pointer[9] = (uint32)a_Argument;
+    Stack_Pointer[10] = 0;
+    Stack_Pointer[11] = 0;
+    Stack_Pointer[12] = 0;
+    Stack_Pointer[13] = 0;
+    Stack_Pointer[14] = (uint32)Os_TaskExit;
+    Stack_Pointer[15] = (uint32)a_Entry & ~0x1UL;
+    Stack_Pointer[16] = OS_INITIAL_XPSR;
+
+    /* A push beyond the end of the stack raises a MemManage fault, the task is not guarded
+     * when all the guard regions are used */
+    MPU_AddStackGuard(a_Stack);
+
+    a_Task->StackPointer = Stack_Pointer;
+    a_Task->Priority = a_Priority;
+    a_Task->Notified = FALSE;
+    SwTimer_Create(&a_Task->Timer, Os_TimerCallBack, a_Task);
+
+    Primask = NVIC_DisableExceptionsSave();
+    g_Os_Tasks[a_Priority] = a_Task;
+    Os_MakeReady(a_Task);
+    NVIC_RestoreExceptions(Primask);
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Os_Start
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to enable the interrupts and run the highest priority task, it never returns.
+ ************************************************************************************/
+void Os_Start(void)
+{
+    Disable_Exceptions();
+
+    /* There is no running task yet ... the first switch only restores the context of the next task */
+    g_Os_CurrentTask = NULL_PTR;
+    g_Os_Started = TRUE;
+    Os_Schedule();
+
+    Enable_Exceptions();
+
+    /* Never reached, main() stack is only used by the handlers from now on */
+    while(1);
+}
+
+
+/************************************************************************************
+ * Service Name: Os_Delay
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Ticks - Number of SysTick ticks to block the calling task
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to block the calling task, the lower priority tasks run meanwhile.
+ *              Must be called from a task with the interrupts enabled.
+ ************************************************************************************/
+void Os_Delay(uint32 a_Ticks)
+{
+    Os_TaskType *Task = g_Os_CurrentTask;
+    uint32 Primask;
+
+    if(a_Ticks == 0)
+    {
+        return;
+    }
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    Task->State = OS_TASK_DELAYED;
+    g_Os_ReadyBitmap &= ~OS_PRIORITY_BIT(Task->Priority);
+    SwTimer_Start(&Task->Timer, a_Ticks, 0);
+    Os_Schedule();
+
+    /* The switch happens here and the task resumes once the timer expired */
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Os_TaskWait
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_TimeoutTicks - Maximum ticks to wait, or OS_WAIT_FOREVER
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if the task is notified, FALSE on timeout
+ * Description: Function to block the calling task until it is notified by Os_TaskNotify, a notification
+ *              sent before the call is not lost. Must be called from a task with the interrupts enabled.
+ ************************************************************************************/
+boolean Os_TaskWait(uint32 a_TimeoutTicks)
+{
+    Os_TaskType *Task = g_Os_CurrentTask;
+    boolean Notified;
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    if((Task->Notified == FALSE) && (a_TimeoutTicks != 0))
+    {
+        Task->State = OS_TASK_WAITING;
+        g_Os_ReadyBitmap &= ~OS_PRIORITY_BIT(Task->Priority);
+        if(a_TimeoutTicks != OS_WAIT_FOREVER)
+        {
+            SwTimer_Start(&Task->Timer, a_TimeoutTicks, 0);
+        }
+        Os_Schedule();
+
+        /* The switch happens here and the task resumes once notified or timed out */
+        NVIC_RestoreExceptions(Primask);
+        Primask = NVIC_DisableExceptionsSave();
+    }
+
+    Notified = Task->Notified;
+    Task->Notified = FALSE;
+    SwTimer_Stop(&Task->Timer);
+
+    NVIC_RestoreExceptions(Primask);
+
+    return Notified;
+}
+
+
+/************************************************************************************
+ * Service Name: Os_TaskNotify
+ * Sync/Async: Asynchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): a_Task - Task to be notified
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to notify a task and make it ready if it is waiting, can be called from ISRs.
+ ************************************************************************************/
+void Os_TaskNotify(Os_TaskType *a_Task)
+{
+    uint32 Primask = NVIC_DisableExceptionsSave();
+
+    a_Task->Notified = TRUE;
+    if(a_Task->State == OS_TASK_WAITING)
+    {
+        Os_MakeReady(a_Task);
+    }
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Os_SetIdleHook
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Hook - Function called by the idle task before each sleep, or NULL_PTR
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to run background work (e.g. draining the log) when no other task is ready.
+ ************************************************************************************/
+void Os_SetIdleHook(Os_IdleHookType a_Hook)
+{
+    g_Os_IdleHook = a_Hook;
+}
+
+
+/************************************************************************************
+ * Service Name: Os_GetStackHighWaterMark
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Task - Task object
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Most bytes ever used on the stack of the task
+ * Description: Function to measure the stack usage of a task, the stack is painted by Os_CreateTask.
+ ************************************************************************************/
+uint32 Os_GetStackHighWaterMark(const Os_TaskType *a_Task)
+{
+    return Stack_GetHighWaterMark(a_Task->StackIndex);
+}
@@ -0,0 +1,174 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Os.h                                                                      *
+ * [DESCRIPTION]    :           Header file for the preemptive fixed-priority kernel                      *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef OS_H_
+#define OS_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "SwTimer.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* One task per priority, 0 is the highest priority and 31 is reserved for the idle task */
+#define OS_PRIORITIES_COUNT       32
+#define OS_IDLE_TASK_PRIORITY     (OS_PRIORITIES_COUNT - 1)
+
+/* PendSV switches the context after all the ISRs are finished, SysTick readies the delayed tasks */
+#define OS_PENDSV_PRIORITY        7
+#define OS_SYSTICK_PRIORITY       6
+
+/* Smallest task stack: the initial context (17 words), an exception frame with the FPU state (26 words)
+ * and the MPU guard region (8 words, up to 15 more when the stack is not aligned) */
+#define OS_MIN_STACK_WORDS        64
+#define OS_IDLE_STACK_WORDS       128
+
+/* Timeout of Os_TaskWait to wait without a timeout */
+#define OS_WAIT_FOREVER           0xFFFFFFFF
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef void (*Os_TaskEntryType)(void *a_Argument);
+
+/* Work done by the idle task before each sleep, must not block */
+typedef void (*Os_IdleHookType)(void);
+
+typedef enum
+{
+    OS_TASK_READY,
+    OS_TASK_DELAYED,
+    OS_TASK_WAITING
+}Os_TaskStateType;
+
+/* Task object ... allocated by the user, the fields are private to the kernel */
+typedef struct
+{
+    uint32                  *StackPointer;   /* Saved PSP, must be the first field (used by PendSV_Handler) */
+    SwTimer_Type             Timer;          /* Expires the delays and the wait timeouts */
+    volatile Os_TaskStateType State;
+    volatile boolean         Notified;
+    uint8                    Priority;
+    uint8                    StackIndex;     /* Entry of the stack in the Stack module */
+}Os_TaskType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Os_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize the kernel, create the idle task and set the PendSV and SysTick priorities.
+*              Must be called after SysTick_Init and SwTimer_Init.
+************************************************************************************/
+void Os_Init(void);
+
+
+/************************************************************************************
+* Service Name: Os_CreateTask
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Entry - Task function, the task is deleted if it returns
+*                , a_Argument - Argument passed to the task function
+*                , a_Stack - Stack of the task, aligned on MPU_GUARD_SIZE (its lowest 32 bytes
+*                            are the no-access guard region)
+*                , a_StackWords - Size of the stack in words (at least OS_MIN_STACK_WORDS)
+*                , a_Priority - Priority of the task (0 is the highest), one task per priority
+* Parameters (inout): a_Task - Task object
+* Parameters (out): None
+* Return value: boolean - FALSE if the priority is used or the stack is too small
+* Description: Function to create a ready task, can be called before or after Os_Start.
+************************************************************************************/
+boolean Os_CreateTask(Os_TaskType *a_Task, Os_TaskEntryType a_Entry, void *a_Argument,
+                      uint32 *a_Stack, uint32 a_StackWords, uint8 a_Priority);
+
+
+/************************************************************************************
+* Service Name: Os_Start
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the interrupts and run the highest priority task, it never returns.
+************************************************************************************/
+void Os_Start(void) __attribute__((noreturn));
+
+
+/************************************************************************************
+* Service Name: Os_Delay
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Ticks - Number of SysTick ticks to block the calling task
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to block the calling task, the lower priority tasks run meanwhile.
+*              Must be called from a task with the interrupts enabled.
+************************************************************************************/
+void Os_Delay(uint32 a_Ticks);
+
+
+/************************************************************************************
+* Service Name: Os_TaskWait
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeoutTicks - Maximum ticks to wait, or OS_WAIT_FOREVER
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the task is notified, FALSE on timeout
+* Description: Function to block the calling task until it is notified by Os_TaskNotify, a notification
+*              sent before the call is not lost. Must be called from a task with the interrupts enabled.
+************************************************************************************/
+boolean Os_TaskWait(uint32 a_TimeoutTicks);
+
+
+/************************************************************************************
+* Service Name: Os_TaskNotify
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): a_Task - Task to be notified
+* Parameters (out): None
+* Return value: None
+* Description: Function to notify a task and make it ready if it is waiting, can be called from ISRs.
+************************************************************************************/
+void Os_TaskNotify(Os_TaskType *a_Task);
+
+
+/************************************************************************************
+* Service Name: Os_SetIdleHook
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Hook - Function called by the idle task before each sleep, or NULL_PTR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to run background work (e.g. draining the log) when no other task is ready.
+************************************************************************************/
+void Os_SetIdleHook(Os_IdleHookType a_Hook);
+
+
+/************************************************************************************
+* Service Name: Os_GetStackHighWaterMark
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Task - Task object
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Most bytes ever used on the stack of the task
+* Description: Function to measure the stack usage of a task, the stack is painted by Os_CreateTask.
+************************************************************************************/
+uint32 Os_GetStackHighWaterMark(const Os_TaskType *a_Task);
+
+#endif /* OS_H_ */
@@ -0,0 +1,70 @@
+;**********************************************************************************************************
+; [FILE NAME]      :           Os_Port.asm                                                                *
+; [DESCRIPTION]    :           PendSV handler of the kernel - deferred work and context switching         *
+; [DATE CREATED]   :           OCT 16, 2026                                                               *
+; [AURTHOR]        :           Alaa Mekawi                                                                *
+;**********************************************************************************************************
+        .thumb
+        .text
+
+        .global PendSV_Handler
+        .global Deferred_ProcessWork
+        .global g_Os_CurrentTask
+        .global g_Os_NextTask
+
+;************************************************************************************
+; Service Name: PendSV_Handler
+; Sync/Async: Asynchronous
+; Reentrancy: Non-reentrant
+; Parameters (in): None
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: None
+; Description: Handler for PendSV exception (lowest priority). Executes the deferred work,
+;              then saves the context of the running task on its stack and restores the
+;              context of g_Os_NextTask. The context is R4-R11, EXC_RETURN and S16-S31
+;              when the task used the FPU (the rest is stacked by the hardware).
+;************************************************************************************
+PendSV_Handler: .asmfunc
+        ; Bottom halves first, they can make a task ready
+        PUSH    {R0, LR}
+        BL      Deferred_ProcessWork
+        POP     {R0, LR}
+
+        CPSID   I
+        LDR     R2, OsCurrentTaskAddr
+        LDR     R1, [R2]
+        LDR     R3, OsNextTaskAddr
+        LDR     R3, [R3]
+        CMP     R1, R3
+        BEQ     PendSV_Exit
+
+        ; No running task on the first switch, nothing to save
+        CBZ     R1, PendSV_Restore
+
+        MRS     R0, PSP
+        TST     LR, #0x10
+        IT      EQ
+        VSTMDBEQ R0!, {S16-S31}
+        STMDB   R0!, {R4-R11, LR}
+        STR     R0, [R1]
+
+PendSV_Restore:
+        STR     R3, [R2]
+        LDR     R0, [R3]
+        LDMIA   R0!, {R4-R11, LR}
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ R0!, {S16-S31}
+        MSR     PSP, R0
+
+PendSV_Exit:
+        CPSIE   I
+        BX      LR
+        .endasmfunc
+
+        .align  4
+OsCurrentTaskAddr:  .word   g_Os_CurrentTask
+OsNextTaskAddr:     .word   g_Os_NextTask
+
+        .end
@@ -0,0 +1,96 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Power.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the TM4C123GH6PM Power (Sleep modes) driver               *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Power.h"
+#include "Clock.h"
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static Power_SleepModeType g_Power_SleepMode = POWER_SLEEP_MODE;
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Power_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_SleepMode - Mode entered by the processor on WFI
+ *                , a_DeepSleepGpioPorts - Mask of the GPIO ports (bit 0 = PORTA ... bit 5 = PORTF)
+ *                                         that stay clocked in Deep-Sleep to wake up the processor
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to select the low power mode entered by the processor when it is idle.
+ *              In Deep-Sleep mode the system clock is switched to the PIOSC and all the peripherals
+ *              are gated except the selected GPIO ports.
+ ************************************************************************************/
+void Power_Init(Power_SleepModeType a_SleepMode, uint8 a_DeepSleepGpioPorts)
+{
+    if(a_SleepMode == POWER_DEEP_SLEEP_MODE)
+    {
+        /* Run from the PIOSC without divider in Deep-Sleep */
+        SYSCTL_DSLPCLKCFG_REG = (SYSCTL_DSLPCLKCFG_REG & ~(DSLPCLKCFG_DSOSCSRC_MASK | DSLPCLKCFG_DSDIVORIDE_MASK))
+                                | DSLPCLKCFG_DSOSCSRC_PIOSC;
+
+        /* Keep only the GPIO ports used as wake-up sources clocked in Deep-Sleep */
+        SYSCTL_DCGCGPIO_REG = a_DeepSleepGpioPorts;
+
+        /* WFI enters Deep-Sleep */
+        NVIC_SYSTEM_SYSCTRL |= SYSCTRL_SLEEPDEEP_BIT_MASK;
+    }
+    else
+    {
+        /* WFI enters Sleep, the clocks are not changed */
+        NVIC_SYSTEM_SYSCTRL &= ~SYSCTRL_SLEEPDEEP_BIT_MASK;
+    }
+
+    g_Power_SleepMode = a_SleepMode;
+}
+
+
+/************************************************************************************
+ * Service Name: Power_GetSleepClockFrequency
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - System clock frequency in Hz while the processor sleeps
+ * Description: Function to get the clock counted by the SysTick during WFI, the PIOSC in Deep-Sleep
+ *              or the run mode system clock in Sleep.
+ ************************************************************************************/
+uint32 Power_GetSleepClockFrequency(void)
+{
+    return (NVIC_SYSTEM_SYSCTRL & SYSCTRL_SLEEPDEEP_BIT_MASK) ? CLOCK_PIOSC_FREQUENCY : Clock_GetSystemClock();
+}
+
+
+/************************************************************************************
+ * Service Name: Power_SetDeepSleepAllowed
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Allowed - FALSE to sleep in Sleep mode while a gated peripheral is in use
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to prevent the Deep-Sleep mode selected by Power_Init for a while, e.g. during
+ *              a UART or uDMA transfer (the peripherals are gated and the clock changes in Deep-Sleep).
+ ************************************************************************************/
+void Power_SetDeepSleepAllowed(boolean a_Allowed)
+{
+    if((a_Allowed == TRUE) && (g_Power_SleepMode == POWER_DEEP_SLEEP_MODE))
+    {
+        NVIC_SYSTEM_SYSCTRL |= SYSCTRL_SLEEPDEEP_BIT_MASK;
+    }
+    else
+    {
+        NVIC_SYSTEM_SYSCTRL &= ~SYSCTRL_SLEEPDEEP_BIT_MASK;
+    }
+}
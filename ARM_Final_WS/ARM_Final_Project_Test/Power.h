@@ -0,0 +1,81 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Power.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the TM4C123GH6PM Power (Sleep modes) driver               *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef POWER_H_
+#define POWER_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define SYSCTRL_SLEEPONEXIT_BIT_MASK         0x00000002
+#define SYSCTRL_SLEEPDEEP_BIT_MASK           0x00000004
+
+/* Deep-Sleep clock source ... PIOSC (16 MHz) without divider, the SysTick counts at this rate in Deep-Sleep */
+#define DSLPCLKCFG_DSOSCSRC_MASK             0x00000070
+#define DSLPCLKCFG_DSOSCSRC_PIOSC            0x00000010
+#define DSLPCLKCFG_DSDIVORIDE_MASK           0x1F800000
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    POWER_SLEEP_MODE,
+    POWER_DEEP_SLEEP_MODE
+}Power_SleepModeType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Power_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_SleepMode - Mode entered by the processor on WFI
+*                , a_DeepSleepGpioPorts - Mask of the GPIO ports (bit 0 = PORTA ... bit 5 = PORTF)
+*                                         that stay clocked in Deep-Sleep to wake up the processor
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the low power mode entered by the processor when it is idle.
+*              In Deep-Sleep mode the system clock is switched to the PIOSC and all the peripherals
+*              are gated except the selected GPIO ports.
+************************************************************************************/
+void Power_Init(Power_SleepModeType a_SleepMode, uint8 a_DeepSleepGpioPorts);
+
+
+/************************************************************************************
+* Service Name: Power_GetSleepClockFrequency
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock frequency in Hz while the processor sleeps
+* Description: Function to get the clock counted by the SysTick during WFI, the PIOSC in Deep-Sleep
+*              or the run mode system clock in Sleep.
+************************************************************************************/
+uint32 Power_GetSleepClockFrequency(void);
+
+
+/************************************************************************************
+* Service Name: Power_SetDeepSleepAllowed
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Allowed - FALSE to sleep in Sleep mode while a gated peripheral is in use
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to prevent the Deep-Sleep mode selected by Power_Init for a while, e.g. during
+*              a UART or uDMA transfer (the peripherals are gated and the clock changes in Deep-Sleep).
+************************************************************************************/
+void Power_SetDeepSleepAllowed(boolean a_Allowed);
+
+#endif /* POWER_H_ */
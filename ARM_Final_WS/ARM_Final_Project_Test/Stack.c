@@ -0,0 +1,204 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Stack.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the stack painting and high-water mark measurement        *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Stack.h"
+#include "MPU.h"
+#include "Line.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Longest line printed by Stack_Dump */
+#define STACK_LINE_LENGTH             48
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 *Bottom;         /* First word above the guard region */
+    uint32 *Top;            /* End of the stack, the stack grows down from it */
+}Stack_EntryType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Start of the .stack section (main stack), defined by the linker */
+extern uint32 __stack[];
+
+static Stack_EntryType g_Stack_Entries[STACK_MAX_COUNT];
+static uint8 g_Stack_Count = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Stack pointer of the caller ... read in Stack_Port.asm on the target, the host never runs on the
+ * main stack so all of it is free */
+#ifdef HOST_SIMULATION
+static uint32 Stack_GetCallerSp(void)
+{
+    return (uint32)&__stack[STACK_MAIN_BYTES / 4];
+}
+#else
+extern uint32 Stack_GetCallerSp(void);
+#endif
+
+/* First word above the guard region added by MPU_AddStackGuard, the guard is never read */
+static uint32 * Stack_GetBottom(uint32 *a_Stack)
+{
+    return (uint32 *)((((uint32)a_Stack + (MPU_GUARD_SIZE - 1)) & MPU_BASE_ADDR_MASK) + MPU_GUARD_SIZE);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Stack_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Paint the free part of the main stack (below the current stack pointer) and register
+ *              it as STACK_MAIN_INDEX. Must be called first in main, before any interrupt is enabled.
+ ************************************************************************************/
+void Stack_Init(void)
+{
+    Stack_EntryType *Entry = &g_Stack_Entries[STACK_MAIN_INDEX];
+    uint32 *Word;
+    uint32 *Stack_Pointer;
+
+    Entry->Bottom = Stack_GetBottom(__stack);
+    Entry->Top = &__stack[STACK_MAIN_BYTES / 4];
+    g_Stack_Count = 1;
+
+    /* The words below SP are free, the loop does not push anything so it never paints its own frame */
+    Stack_Pointer = (uint32 *)Stack_GetCallerSp();
+    for(Word = Entry->Bottom; Word < Stack_Pointer; Word++)
+    {
+        *Word = STACK_PAINT_PATTERN;
+    }
+}
+
+
+/************************************************************************************
+ * Service Name: Stack_Register
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Stack - Lowest address of the stack (the array of the stack)
+ *                , a_Words - Size of the stack in words
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - Index of the stack, STACK_INVALID_INDEX if all the entries are used
+ * Description: Function to paint a stack not used yet and register it for the high-water mark.
+ *              The lowest 32 bytes (the MPU guard region) are neither painted nor read.
+ ************************************************************************************/
+uint8 Stack_Register(uint32 *a_Stack, uint32 a_Words)
+{
+    Stack_EntryType *Entry;
+    uint32 *Word;
+
+    if(g_Stack_Count == STACK_MAX_COUNT)
+    {
+        return STACK_INVALID_INDEX;
+    }
+
+    Entry = &g_Stack_Entries[g_Stack_Count];
+    Entry->Bottom = Stack_GetBottom(a_Stack);
+    Entry->Top = &a_Stack[a_Words];
+    for(Word = Entry->Bottom; Word < Entry->Top; Word++)
+    {
+        *Word = STACK_PAINT_PATTERN;
+    }
+
+    return g_Stack_Count++;
+}
+
+
+/************************************************************************************
+ * Service Name: Stack_GetHighWaterMark
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Index - Index of the stack returned by Stack_Register or STACK_MAIN_INDEX
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Most bytes ever used on the stack, 0 for an unknown index
+ * Description: Function to find the lowest word written on the stack, the painted words are read
+ *              from the bottom so the time grows with the free space, not with the stack size.
+ ************************************************************************************/
+uint32 Stack_GetHighWaterMark(uint8 a_Index)
+{
+    const uint32 *Word;
+
+    if(a_Index >= g_Stack_Count)
+    {
+        return 0;
+    }
+
+    Word = g_Stack_Entries[a_Index].Bottom;
+    while((Word < g_Stack_Entries[a_Index].Top) && (*Word == STACK_PAINT_PATTERN))
+    {
+        Word++;
+    }
+    return (uint32)g_Stack_Entries[a_Index].Top - (uint32)Word;
+}
+
+
+/************************************************************************************
+ * Service Name: Stack_GetSize
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Index - Index of the stack returned by Stack_Register or STACK_MAIN_INDEX
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Usable bytes of the stack (guard region excluded), 0 for an unknown index
+ * Description: Function to get the size the high-water mark is compared with.
+ ************************************************************************************/
+uint32 Stack_GetSize(uint8 a_Index)
+{
+    if(a_Index >= g_Stack_Count)
+    {
+        return 0;
+    }
+    return (uint32)g_Stack_Entries[a_Index].Top - (uint32)g_Stack_Entries[a_Index].Bottom;
+}
+
+
+/************************************************************************************
+ * Service Name: Stack_Dump
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_PutString - Function writing one line of text
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to print the high-water mark of every registered stack, one line per stack:
+ *              "S<index> used=<bytes> size=<bytes>", S0 is the main stack and the task stacks
+ *              follow in their creation order. Must be called from thread mode.
+ ************************************************************************************/
+void Stack_Dump(Stack_PutStringType a_PutString)
+{
+    char Buffer[STACK_LINE_LENGTH];
+    Line_Type Line;
+    uint8 Index;
+
+    for(Index = 0; Index < g_Stack_Count; Index++)
+    {
+        Line_Init(&Line, Buffer, sizeof(Buffer));
+        Line_AppendString(&Line, "S");
+        Line_AppendNumber(&Line, Index);
+        Line_AppendString(&Line, " used=");
+        Line_AppendNumber(&Line, Stack_GetHighWaterMark(Index));
+        Line_AppendString(&Line, " size=");
+        Line_AppendNumber(&Line, Stack_GetSize(Index));
+        Line_AppendString(&Line, "\r\n");
+
+        a_PutString(Buffer);
+    }
+}
@@ -0,0 +1,107 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Stack.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the stack painting and high-water mark measurement        *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef STACK_H_
+#define STACK_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Size of the .stack section (main stack) ... --stack_size of the project and __STACK_TOP in
+ * tm4c123gh6pm.cmd must be changed together with it */
+#define STACK_MAIN_BYTES              512
+
+/* Value of the free words, a word still holding it was never written */
+#define STACK_PAINT_PATTERN           0xC5C5C5C5
+
+/* Main stack and the task stacks, index 0 is the main stack */
+#define STACK_MAX_COUNT               8
+#define STACK_MAIN_INDEX              0
+#define STACK_INVALID_INDEX           0xFF
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* Output of Stack_Dump, called with one line at a time */
+typedef void (*Stack_PutStringType)(const char *a_String);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Stack_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Paint the free part of the main stack (below the current stack pointer) and register
+*              it as STACK_MAIN_INDEX. Must be called first in main, before any interrupt is enabled.
+************************************************************************************/
+void Stack_Init(void);
+
+
+/************************************************************************************
+* Service Name: Stack_Register
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Stack - Lowest address of the stack (the array of the stack)
+*                , a_Words - Size of the stack in words
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - Index of the stack, STACK_INVALID_INDEX if all the entries are used
+* Description: Function to paint a stack not used yet and register it for the high-water mark.
+*              The lowest 32 bytes (the MPU guard region) are neither painted nor read.
+************************************************************************************/
+uint8 Stack_Register(uint32 *a_Stack, uint32 a_Words);
+
+
+/************************************************************************************
+* Service Name: Stack_GetHighWaterMark
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Index - Index of the stack returned by Stack_Register or STACK_MAIN_INDEX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Most bytes ever used on the stack, 0 for an unknown index
+* Description: Function to find the lowest word written on the stack, the painted words are read
+*              from the bottom so the time grows with the free space, not with the stack size.
+************************************************************************************/
+uint32 Stack_GetHighWaterMark(uint8 a_Index);
+
+
+/************************************************************************************
+* Service Name: Stack_GetSize
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Index - Index of the stack returned by Stack_Register or STACK_MAIN_INDEX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Usable bytes of the stack (guard region excluded), 0 for an unknown index
+* Description: Function to get the size the high-water mark is compared with.
+************************************************************************************/
+uint32 Stack_GetSize(uint8 a_Index);
+
+
+/************************************************************************************
+* Service Name: Stack_Dump
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_PutString - Function writing one line of text
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to print the high-water mark of every registered stack, one line per stack:
+*              "S<index> used=<bytes> size=<bytes>", S0 is the main stack and the task stacks
+*              follow in their creation order. Must be called from thread mode.
+************************************************************************************/
+void Stack_Dump(Stack_PutStringType a_PutString);
+
+#endif /* STACK_H_ */
@@ -0,0 +1,28 @@
+;**********************************************************************************************************
+; [FILE NAME]      :           Stack_Port.asm                                                             *
+; [DESCRIPTION]    :           Stack pointer access of the stack painting                                 *
+; [DATE CREATED]   :           OCT 17, 2026                                                               *
+; [AURTHOR]        :           Alaa Mekawi                                                                *
+;**********************************************************************************************************
+        .thumb
+        .text
+
+        .global Stack_GetCallerSp
+
+;************************************************************************************
+; Service Name: Stack_GetCallerSp
+; Sync/Async: Synchronous
+; Reentrancy: reentrant
+; Parameters (in): None
+; Parameters (inout): None
+; Parameters (out): None
+; Return value: uint32 - Stack pointer of the caller (R0)
+; Description: Function to read the stack pointer, the call and this function push nothing so
+;              SP is the one of the caller. The words below it are free.
+;************************************************************************************
+Stack_GetCallerSp: .asmfunc
+        MOV     R0, SP
+        BX      LR
+        .endasmfunc
+
+        .end
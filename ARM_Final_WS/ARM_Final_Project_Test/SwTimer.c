@@ -0,0 +1,429 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           SwTimer.c                                                                 *
+ * [DESCRIPTION]    :           Source file for the Software Timers service (hierarchical timer wheel)    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "SwTimer.h"
+#include "SysTick.h"
+#include "NVIC.h"
+#include "IsrStats.h"
+#include "common_macros.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* Slot values of a timer that is not linked to the wheel */
+#define SWTIMER_SLOT_NONE         0xFF
+#define SWTIMER_SLOT_WORK_LIST    0xFE
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Slots of all the levels ... slot (Level * 32 + Index) holds a list of timers */
+static SwTimer_Type *g_SwTimer_Wheel[SWTIMER_SLOTS_COUNT];
+
+/* One bit per slot set when the slot is not empty, used to skip empty slots with CLZ */
+static uint32 g_SwTimer_Occupied[SWTIMER_LEVELS_COUNT];
+
+/* Next tick to be processed by the wheel */
+static uint32 g_SwTimer_NextTick = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Link a timer to the slot of its expiry tick ... must be called inside a critical section */
+static void SwTimer_Link(SwTimer_Type *a_Timer)
+{
+    uint32 Expiry = a_Timer->Expiry;
+    uint32 Delta = Expiry - g_SwTimer_NextTick;
+    uint8 Level = 0;
+    uint8 Slot;
+
+    if((sint32)Delta < 0)
+    {
+        /* Already expired ... expire it on the next processed tick */
+        Expiry = g_SwTimer_NextTick;
+        Delta = 0;
+    }
+    else if(Delta > SWTIMER_MAX_DELAY_TICKS)
+    {
+        /* Beyond the wheel range ... park it in the farthest slot, it is linked again when this slot is cascaded */
+        Expiry = g_SwTimer_NextTick + SWTIMER_MAX_DELAY_TICKS;
+        Delta = SWTIMER_MAX_DELAY_TICKS;
+    }
+
+    /* Level N holds the timers expiring in less than 32^(N+1) ticks */
+    while(Delta >= (1UL << ((Level + 1) * SWTIMER_LEVEL_BITS)))
+    {
+        Level++;
+    }
+
+    Slot = (uint8)((Level * SWTIMER_LEVEL_SIZE) + ((Expiry >> (Level * SWTIMER_LEVEL_BITS)) & SWTIMER_LEVEL_MASK));
+
+    /* Insert at the head of the slot list */
+    a_Timer->Next = g_SwTimer_Wheel[Slot];
+    if(a_Timer->Next != NULL_PTR)
+    {
+        a_Timer->Next->PPrev = &a_Timer->Next;
+    }
+    a_Timer->PPrev = &g_SwTimer_Wheel[Slot];
+    g_SwTimer_Wheel[Slot] = a_Timer;
+    a_Timer->Slot = Slot;
+
+    g_SwTimer_Occupied[Level] |= (1UL << (Slot & SWTIMER_LEVEL_MASK));
+}
+
+/* Unlink a timer from its slot or from the work list ... must be called inside a critical section */
+static void SwTimer_Unlink(SwTimer_Type *a_Timer)
+{
+    *(a_Timer->PPrev) = a_Timer->Next;
+    if(a_Timer->Next != NULL_PTR)
+    {
+        a_Timer->Next->PPrev = a_Timer->PPrev;
+    }
+
+    /* Clear the occupied bit if the slot became empty */
+    if((a_Timer->Slot < SWTIMER_SLOTS_COUNT) && (g_SwTimer_Wheel[a_Timer->Slot] == NULL_PTR))
+    {
+        g_SwTimer_Occupied[a_Timer->Slot >> SWTIMER_LEVEL_BITS] &= ~(1UL << (a_Timer->Slot & SWTIMER_LEVEL_MASK));
+    }
+
+    a_Timer->Slot = SWTIMER_SLOT_NONE;
+}
+
+/* Move all the timers of an upper level slot to the lower levels ... must be called inside a critical section */
+static void SwTimer_Cascade(uint8 a_Level, uint8 a_Index)
+{
+    uint8 Slot = (uint8)((a_Level * SWTIMER_LEVEL_SIZE) + a_Index);
+    SwTimer_Type *Timer = g_SwTimer_Wheel[Slot];
+    SwTimer_Type *Next;
+
+    g_SwTimer_Wheel[Slot] = NULL_PTR;
+    g_SwTimer_Occupied[a_Level] &= ~(1UL << a_Index);
+
+    while(Timer != NULL_PTR)
+    {
+        Next = Timer->Next;
+        SwTimer_Link(Timer);
+        Timer = Next;
+    }
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: SwTimer_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize the timer wheel, must be called after SysTick_Init.
+ ************************************************************************************/
+void SwTimer_Init(void)
+{
+    uint8 Slot;
+    uint8 Level;
+
+    for(Slot = 0; Slot < SWTIMER_SLOTS_COUNT; Slot++)
+    {
+        g_SwTimer_Wheel[Slot] = NULL_PTR;
+    }
+
+    for(Level = 0; Level < SWTIMER_LEVELS_COUNT; Level++)
+    {
+        g_SwTimer_Occupied[Level] = 0;
+    }
+
+    /* The next SysTick interrupt is the first tick to be processed */
+    g_SwTimer_NextTick = SysTick_GetTickCount() + 1;
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_Create
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_CallBack - Function called from the SysTick handler when the timer expires
+ *                , a_Context - User pointer passed to the call back function
+ * Parameters (inout): a_Timer - Timer object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to initialize a timer object, the timer is created stopped.
+ ************************************************************************************/
+void SwTimer_Create(SwTimer_Type *a_Timer, SwTimer_CallBackType a_CallBack, void *a_Context)
+{
+    a_Timer->Next = NULL_PTR;
+    a_Timer->PPrev = NULL_PTR;
+    a_Timer->Expiry = 0;
+    a_Timer->Period = 0;
+    a_Timer->CallBack = a_CallBack;
+    a_Timer->Context = a_Context;
+    a_Timer->Slot = SWTIMER_SLOT_NONE;
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_Start
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_DelayTicks - Ticks until the first expiry
+ *                , a_PeriodTicks - Period in ticks for periodic timers, 0 for one-shot timers
+ * Parameters (inout): a_Timer - Timer object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to start (or restart) a timer in O(1). Can be called from ISRs and from
+ *              the call back functions.
+ ************************************************************************************/
+void SwTimer_Start(SwTimer_Type *a_Timer, uint32 a_DelayTicks, uint32 a_PeriodTicks)
+{
+    uint32 Primask;
+
+    /* The earliest expiry is the next tick */
+    if(a_DelayTicks == 0)
+    {
+        a_DelayTicks = 1;
+    }
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    if(a_Timer->Slot != SWTIMER_SLOT_NONE)
+    {
+        SwTimer_Unlink(a_Timer);
+    }
+
+    a_Timer->Expiry = SysTick_GetTickCount() + a_DelayTicks;
+    a_Timer->Period = a_PeriodTicks;
+    SwTimer_Link(a_Timer);
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_Stop
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): a_Timer - Timer object
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to stop a timer in O(1), nothing is done if the timer is not running.
+ ************************************************************************************/
+void SwTimer_Stop(SwTimer_Type *a_Timer)
+{
+    uint32 Primask = NVIC_DisableExceptionsSave();
+
+    if(a_Timer->Slot != SWTIMER_SLOT_NONE)
+    {
+        SwTimer_Unlink(a_Timer);
+    }
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_IsActive
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Timer - Timer object
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if the timer is running
+ * Description: Function to check if a timer is running.
+ ************************************************************************************/
+boolean SwTimer_IsActive(const SwTimer_Type *a_Timer)
+{
+    return (a_Timer->Slot != SWTIMER_SLOT_NONE) ? TRUE : FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_ProcessTicks
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to advance the wheel up to the current SysTick tick count and call the
+ *              call backs of the expired timers. Called by SwTimer_SysTickHandler on each tick,
+ *              empty slots are skipped so ticks suppressed by the tickless idle cost nothing.
+ ************************************************************************************/
+void SwTimer_ProcessTicks(void)
+{
+    uint32 Now = SysTick_GetTickCount();
+    uint32 Primask;
+    uint32 Index;
+    uint32 Upper_Index;
+    uint32 Pending;
+    uint32 Skip;
+    uint8 Level;
+    SwTimer_Type *Work_List;
+    SwTimer_Type *Timer;
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    while((sint32)(Now - g_SwTimer_NextTick) >= 0)
+    {
+        Index = g_SwTimer_NextTick & SWTIMER_LEVEL_MASK;
+
+        /* Level 0 wrapped ... bring the timers of the next upper slot down, and so on for the upper levels */
+        if(Index == 0)
+        {
+            Level = 1;
+            do
+            {
+                Upper_Index = (g_SwTimer_NextTick >> (Level * SWTIMER_LEVEL_BITS)) & SWTIMER_LEVEL_MASK;
+                SwTimer_Cascade(Level, (uint8)Upper_Index);
+                Level++;
+            } while((Upper_Index == 0) && (Level < SWTIMER_LEVELS_COUNT));
+        }
+
+        if(!(g_SwTimer_Occupied[0] & (1UL << Index)))
+        {
+            /* Empty slot ... jump to the next occupied slot or the next cascade, but not beyond the current tick */
+            Pending = g_SwTimer_Occupied[0] & (0xFFFFFFFFUL << Index);
+            Skip = (Pending != 0) ? (COUNT_TRAILING_ZEROS(Pending) - Index) : (SWTIMER_LEVEL_SIZE - Index);
+            if(Skip > (Now - g_SwTimer_NextTick + 1))
+            {
+                Skip = Now - g_SwTimer_NextTick + 1;
+            }
+            g_SwTimer_NextTick += Skip;
+            continue;
+        }
+
+        /* Move the expired timers to a work list, so the call backs can start and stop any timer */
+        Work_List = g_SwTimer_Wheel[Index];
+        Work_List->PPrev = &Work_List;
+        g_SwTimer_Wheel[Index] = NULL_PTR;
+        g_SwTimer_Occupied[0] &= ~(1UL << Index);
+        for(Timer = Work_List; Timer != NULL_PTR; Timer = Timer->Next)
+        {
+            Timer->Slot = SWTIMER_SLOT_WORK_LIST;
+        }
+
+        g_SwTimer_NextTick++;
+
+        while(Work_List != NULL_PTR)
+        {
+            Timer = Work_List;
+            SwTimer_Unlink(Timer);
+
+            /* Periodic timers are re-scheduled relative to the previous expiry so they never drift */
+            if(Timer->Period != 0)
+            {
+                Timer->Expiry += Timer->Period;
+                SwTimer_Link(Timer);
+            }
+
+            /* Call back with the interrupts enabled */
+            NVIC_RestoreExceptions(Primask);
+            Timer->CallBack(Timer->Context);
+            Primask = NVIC_DisableExceptionsSave();
+        }
+    }
+
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_SysTickHandler
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Handler for SysTick interrupt that keeps the time base then advances the wheel,
+ *              registered in the SRAM vector table with NVIC_RegisterHandler.
+ ************************************************************************************/
+void SwTimer_SysTickHandler(void)
+{
+    SysTick_EnterInterrupt();
+
+    /* Measure the latency before the next reload value is queued */
+    ISR_STATS_ENTER();
+
+    if(SysTick_ProcessInterrupt() == TRUE)
+    {
+        SwTimer_ProcessTicks();
+    }
+
+    ISR_STATS_EXIT();
+}
+
+
+/************************************************************************************
+ * Service Name: SwTimer_GetNextExpiry
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Tick at which the wheel has to be processed next
+ * Description: Function to get the tick of the next expiry (or the next cascade of a far timer),
+ *              used as the wake-up tick of the tickless idle.
+ ************************************************************************************/
+uint32 SwTimer_GetNextExpiry(void)
+{
+    uint32 Primask;
+    uint32 Next_Expiry;
+    uint32 Candidate;
+    uint32 Rotation_Base;
+    uint32 Occupied;
+    uint32 Pending;
+    uint32 Current;
+    uint32 Start;
+    uint8 Shift;
+    uint8 Level;
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    /* Nothing to wait for ... the farthest tick the wheel can handle */
+    Next_Expiry = g_SwTimer_NextTick + SWTIMER_MAX_DELAY_TICKS;
+
+    for(Level = 0; Level < SWTIMER_LEVELS_COUNT; Level++)
+    {
+        Occupied = g_SwTimer_Occupied[Level];
+        if(Occupied == 0)
+        {
+            continue;
+        }
+
+        Shift = (uint8)(Level * SWTIMER_LEVEL_BITS);
+        Current = (g_SwTimer_NextTick >> Shift) & SWTIMER_LEVEL_MASK;
+        Rotation_Base = g_SwTimer_NextTick & ~((1UL << (Shift + SWTIMER_LEVEL_BITS)) - 1);
+
+        /* The current slot of an upper level is cascaded when the lower levels wrap, once it is cascaded the
+         * timers linked to it belong to the next rotation */
+        Start = ((g_SwTimer_NextTick & ((1UL << Shift) - 1)) == 0) ? Current : (Current + 1);
+        Pending = (Start < SWTIMER_LEVEL_SIZE) ? (Occupied & (0xFFFFFFFFUL << Start)) : 0;
+
+        if(Pending != 0)
+        {
+            Candidate = Rotation_Base + (COUNT_TRAILING_ZEROS(Pending) << Shift);
+        }
+        else
+        {
+            Candidate = Rotation_Base + (1UL << (Shift + SWTIMER_LEVEL_BITS)) + (COUNT_TRAILING_ZEROS(Occupied) << Shift);
+        }
+
+        /* Level 0 gives the exact expiry, the upper levels give the tick at which their slot is cascaded */
+        if((sint32)(Candidate - Next_Expiry) < 0)
+        {
+            Next_Expiry = Candidate;
+        }
+    }
+
+    NVIC_RestoreExceptions(Primask);
+
+    return Next_Expiry;
+}
@@ -0,0 +1,156 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           SwTimer.h                                                                 *
+ * [DESCRIPTION]    :           Header file for the Software Timers service (hierarchical timer wheel)    *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* The wheel has 4 levels of 32 slots ... level N slot covers 32^N ticks */
+#define SWTIMER_LEVEL_BITS        5
+#define SWTIMER_LEVEL_SIZE        (1UL << SWTIMER_LEVEL_BITS)
+#define SWTIMER_LEVEL_MASK        (SWTIMER_LEVEL_SIZE - 1)
+#define SWTIMER_LEVELS_COUNT      4
+#define SWTIMER_SLOTS_COUNT       (SWTIMER_LEVELS_COUNT * SWTIMER_LEVEL_SIZE)
+
+/* Longest delay covered by the wheel (2^20 - 1 ticks), longer timers are re-cascaded until they expire */
+#define SWTIMER_MAX_DELAY_TICKS   ((1UL << (SWTIMER_LEVELS_COUNT * SWTIMER_LEVEL_BITS)) - 1)
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef void (*SwTimer_CallBackType)(void *a_Context);
+
+/* Timer object ... allocated by the user, the fields are private to the service */
+typedef struct SwTimer_Tag
+{
+    struct SwTimer_Tag  *Next;       /* Next timer in the same slot */
+    struct SwTimer_Tag **PPrev;      /* Link pointing to this timer, used to unlink it in O(1) */
+    uint32               Expiry;     /* Absolute tick of the next expiry */
+    uint32               Period;     /* Period in ticks, 0 for one-shot timers */
+    SwTimer_CallBackType CallBack;
+    void                *Context;
+    uint8                Slot;       /* Slot the timer is linked to */
+}SwTimer_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: SwTimer_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize the timer wheel, must be called after SysTick_Init.
+************************************************************************************/
+void SwTimer_Init(void);
+
+
+/************************************************************************************
+* Service Name: SwTimer_Create
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_CallBack - Function called from the SysTick handler when the timer expires
+*                , a_Context - User pointer passed to the call back function
+* Parameters (inout): a_Timer - Timer object
+* Parameters (out): None
+* Return value: None
+* Description: Function to initialize a timer object, the timer is created stopped.
+************************************************************************************/
+void SwTimer_Create(SwTimer_Type *a_Timer, SwTimer_CallBackType a_CallBack, void *a_Context);
+
+
+/************************************************************************************
+* Service Name: SwTimer_Start
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_DelayTicks - Ticks until the first expiry
+*                , a_PeriodTicks - Period in ticks for periodic timers, 0 for one-shot timers
+* Parameters (inout): a_Timer - Timer object
+* Parameters (out): None
+* Return value: None
+* Description: Function to start (or restart) a timer in O(1). Can be called from ISRs and from
+*              the call back functions.
+************************************************************************************/
+void SwTimer_Start(SwTimer_Type *a_Timer, uint32 a_DelayTicks, uint32 a_PeriodTicks);
+
+
+/************************************************************************************
+* Service Name: SwTimer_Stop
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): a_Timer - Timer object
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a timer in O(1), nothing is done if the timer is not running.
+************************************************************************************/
+void SwTimer_Stop(SwTimer_Type *a_Timer);
+
+
+/************************************************************************************
+* Service Name: SwTimer_IsActive
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Timer - Timer object
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the timer is running
+* Description: Function to check if a timer is running.
+************************************************************************************/
+boolean SwTimer_IsActive(const SwTimer_Type *a_Timer);
+
+
+/************************************************************************************
+* Service Name: SwTimer_ProcessTicks
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to advance the wheel up to the current SysTick tick count and call the
+*              call backs of the expired timers. Called by SwTimer_SysTickHandler on each tick,
+*              empty slots are skipped so ticks suppressed by the tickless idle cost nothing.
+************************************************************************************/
+void SwTimer_ProcessTicks(void);
+
+
+/************************************************************************************
+* Service Name: SwTimer_SysTickHandler
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler for SysTick interrupt that keeps the time base then advances the wheel,
+*              registered in the SRAM vector table with NVIC_RegisterHandler.
+************************************************************************************/
+void SwTimer_SysTickHandler(void);
+
+
+/************************************************************************************
+* Service Name: SwTimer_GetNextExpiry
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Tick at which the wheel has to be processed next
+* Description: Function to get the tick of the next expiry (or the next cascade of a far timer),
+*              used as the wake-up tick of the tickless idle.
+************************************************************************************/
+uint32 SwTimer_GetNextExpiry(void);
+
+#endif /* SWTIMER_H_ */
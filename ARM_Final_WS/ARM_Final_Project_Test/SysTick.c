@@ -8,10 +8,192 @@
  *                                Inclusions                                   *
  *******************************************************************************/
 #include "SysTick.h"
+#include "Clock.h"
+#include "Power.h"
+#include "IsrStats.h"
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* The tick period is counted by the 24-bit hardware counter in chunks, each wrap ends a chunk.
+ * The time base is kept in absolute system clock cycles since SysTick_Init */
+typedef struct
+{
+    uint64 TickCount;           /* Ticks counted by the handler, or on wake-up from a tickless sleep */
+    uint64 NotifiedTickCount;   /* Ticks already notified to the application by the handler */
+    uint64 NextTickCycles;      /* Cycle of the first tick boundary not counted yet */
+    uint64 PeriodCycles;        /* Tick period in cycles */
+    uint64 ChunkStartCycles;    /* Cycle at which the chunk counted by the hardware started */
+    uint32 RunningChunk;        /* Length of the chunk counted by the hardware */
+    uint32 QueuedChunk;         /* Length written to the reload register, loaded at the next wrap */
+}SysTick_StateType;
+
 /*******************************************************************************
  *                           Global Variables                                  *
  *******************************************************************************/
-static volatile void (*g_callBackPtr)(void) = NULL_PTR;
+/* Time base state ... double buffered, the writer updates the inactive copy then increments the
+ * generation so a reader (even one preempting the writer) always finds a complete state without
+ * masking the interrupts */
+static volatile SysTick_StateType g_SysTick_State[2];
+static volatile uint32 g_SysTick_StateGeneration = 0;
+
+/* Generation of the state the running handler replaces ... the exception entry clears the pending
+ * bit before the handler publishes the wrap, a reader preempting it in between finds the mark */
+static volatile uint32 g_SysTick_HandlerGeneration = 0xFFFFFFFF;
+
+static SysTick_ModeType g_SysTick_Mode = SYSTICK_MODE_EXACT;
+
+/* System clock frequency used to compute the tick period */
+static uint32 g_SysTick_ClockFrequency = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Convert a number of cycles of a clock to the number of cycles of another clock */
+static uint32 SysTick_ScaleCycles(uint32 a_Cycles, uint32 a_ToFrequency, uint32 a_FromFrequency)
+{
+    if(a_ToFrequency == a_FromFrequency)
+    {
+        return a_Cycles;
+    }
+
+    return (uint32)(((uint64)a_Cycles * a_ToFrequency) / a_FromFrequency);
+}
+
+/* Get a copy of the published state */
+static void SysTick_ReadState(SysTick_StateType *a_State)
+{
+    uint32 Generation;
+
+    do
+    {
+        Generation = g_SysTick_StateGeneration;
+        *a_State = g_SysTick_State[Generation & 1];
+    }while(Generation != g_SysTick_StateGeneration);
+}
+
+/* Publish a new state ... called by the SysTick handler, or with the interrupts disabled */
+static void SysTick_PublishState(const SysTick_StateType *a_State)
+{
+    uint32 Generation = g_SysTick_StateGeneration;
+
+    g_SysTick_State[(Generation + 1) & 1] = *a_State;
+
+    /* The new state must be complete before it is published */
+    Data_Memory_Barrier();
+    g_SysTick_StateGeneration = Generation + 1;
+}
+
+/* A chunk ended and the state of a_Generation does not account it yet, the handler is pending or
+ * it was entered and did not publish the wrap */
+static boolean SysTick_IsChunkEnded(uint32 a_Generation)
+{
+    if((NVIC_SYSTEM_INTCTRL & SYSTICK_PEND_BIT_MASK) || (g_SysTick_HandlerGeneration == a_Generation))
+    {
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Count the tick boundaries reached at the cycle a_Now */
+static void SysTick_CountTicks(SysTick_StateType *a_State, uint64 a_Now)
+{
+    uint64 Crossed_Ticks;
+
+    if(a_Now >= a_State->NextTickCycles)
+    {
+        Crossed_Ticks = ((a_Now - a_State->NextTickCycles) / a_State->PeriodCycles) + 1;
+        a_State->TickCount += Crossed_Ticks;
+        a_State->NextTickCycles += Crossed_Ticks * a_State->PeriodCycles;
+    }
+}
+
+/* Length of the chunk starting at the cycle a_Start ... chunks end on the tick boundaries, long
+ * distances are split in equal chunks and in SYSTICK_MODE_MIN_INTERRUPTS short periods are grouped */
+static uint32 SysTick_PlanChunk(const SysTick_StateType *a_State, uint64 a_Start)
+{
+    uint64 Boundary = a_State->NextTickCycles;
+    uint64 Distance;
+    uint64 Chunks;
+
+    /* The running chunk may cross boundaries that are counted at its end */
+    if(Boundary <= a_Start)
+    {
+        Boundary += (((a_Start - Boundary) / a_State->PeriodCycles) + 1) * a_State->PeriodCycles;
+    }
+    Distance = Boundary - a_Start;
+
+    if(g_SysTick_Mode == SYSTICK_MODE_MIN_INTERRUPTS)
+    {
+        /* Add as many whole periods as the counter can hold, the handler counts them at once */
+        if(Distance < SYSTICK_MAX_CHUNK_CYCLES)
+        {
+            Distance += ((SYSTICK_MAX_CHUNK_CYCLES - Distance) / a_State->PeriodCycles) * a_State->PeriodCycles;
+        }
+    }
+    else if(Distance < SYSTICK_MIN_CHUNK_CYCLES)
+    {
+        /* Too close to re-program the counter (only after a period change or a sleep) ... end on the next boundary */
+        Distance += a_State->PeriodCycles;
+    }
+
+    if(Distance > SYSTICK_MAX_CHUNK_CYCLES)
+    {
+        /* Equal chunks, the remaining ones are planned again from the next chunk start so the last one
+         * ends exactly on the boundary */
+        Chunks = (Distance + (SYSTICK_MAX_CHUNK_CYCLES - 1)) / SYSTICK_MAX_CHUNK_CYCLES;
+        Distance = Distance / Chunks;
+    }
+
+    return (uint32)Distance;
+}
+
+/* Take a consistent sample of the state and of the current cycle. A wrap whose handler did not
+ * publish it yet (pending, or preempted by a higher priority ISR) is accounted, and the sample is
+ * taken again if the handler published in the middle of it */
+static uint64 SysTick_SampleCycles(SysTick_StateType *a_State)
+{
+    uint32 Generation;
+    uint32 Current_Value;
+
+    do
+    {
+        Generation = g_SysTick_StateGeneration;
+        *a_State = g_SysTick_State[Generation & 1];
+        Current_Value = SYSTICK_CURRENT_REG;
+
+        if(SysTick_IsChunkEnded(Generation) == TRUE)
+        {
+            /* The counter re-loaded before or after the first read ... read it again after the re-load */
+            Current_Value = SYSTICK_CURRENT_REG;
+            a_State->ChunkStartCycles += a_State->RunningChunk;
+            a_State->RunningChunk = a_State->QueuedChunk;
+        }
+    }while(Generation != g_SysTick_StateGeneration);
+
+    if(Current_Value >= a_State->RunningChunk)
+    {
+        /* Still at the chunk start (the counter did not load the chunk yet) */
+        Current_Value = a_State->RunningChunk - 1;
+    }
+
+    return a_State->ChunkStartCycles + ((a_State->RunningChunk - 1) - Current_Value);
+}
+
+/* Calculate the period in cycles and check it can be generated in the current mode */
+static boolean SysTick_PeriodToCycles(uint64 a_PeriodMicroSeconds, uint64 *a_PeriodCycles)
+{
+    *a_PeriodCycles = a_PeriodMicroSeconds * (g_SysTick_ClockFrequency / 1000000);
+
+    /* Every period is an interrupt in SYSTICK_MODE_EXACT, it must leave time to re-program the counter */
+    if((*a_PeriodCycles == 0) ||
+       ((g_SysTick_Mode == SYSTICK_MODE_EXACT) && (*a_PeriodCycles < SYSTICK_MIN_CHUNK_CYCLES)))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
 
 /*******************************************************************************
  *                      Functions Definitions                                   *
@@ -26,27 +208,129 @@ static volatile void (*g_callBackPtr)(void) = NULL_PTR;
  * Return value: None
  * Description: Initialize the SysTick timer with the specified time in milliseconds
  *              using interrupts. This function is used to setup the timer to generate periodic
- *              interrupts every specified time in milliseconds.
+ *              interrupts every specified time in milliseconds. The reload value is calculated
+ *              from the current system clock, so it must be called after Clock_Init.
  ************************************************************************************/
 void SysTick_Init(uint16 a_TimeInMilliSeconds)
 {
-    uint32 Reload_Value ;
+    SysTick_InitPeriod((uint64)a_TimeInMilliSeconds * 1000, SYSTICK_MODE_EXACT);
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_InitPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: non-reentrant
+ * Parameters (in): a_PeriodMicroSeconds - Tick period in micro-seconds, from micro-seconds to hours
+ *                , a_Mode - SYSTICK_MODE_EXACT: the handler runs at the end of every period, periods
+ *                           longer than the 24-bit counter are split in equal chunks
+ *                           SYSTICK_MODE_MIN_INTERRUPTS: short periods are grouped so the handler runs
+ *                           at most once per counter range (about 0.2 s at 80 MHz) and counts all of them
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the period is too short for the mode
+ * Description: Initialize the SysTick timer with any tick period by extending the 24-bit counter in
+ *              software, the periods are exact in both modes. Must be called after Clock_Init.
+ ************************************************************************************/
+boolean SysTick_InitPeriod(uint64 a_PeriodMicroSeconds, SysTick_ModeType a_Mode)
+{
+    SysTick_StateType State;
 
     /* Disable SysTick Timer at first */
     SYSTICK_CTRL_REG = 0;
 
-    /* Calculate the reload value for the specified time in milliseconds */
-    Reload_Value = (16000000 / 1000) * a_TimeInMilliSeconds;
+    g_SysTick_ClockFrequency = Clock_GetSystemClock();
+    g_SysTick_Mode = a_Mode;
+
+    if(SysTick_PeriodToCycles(a_PeriodMicroSeconds, &State.PeriodCycles) == FALSE)
+    {
+        return FALSE;
+    }
 
-    /*Set in Reload Register Reload Value to set Timer to Count desired time */
-    SYSTICK_RELOAD_REG = Reload_Value - 1;
+    /* Restart the time base */
+    State.TickCount = 0;
+    State.NotifiedTickCount = 0;
+    State.NextTickCycles = State.PeriodCycles;
+    State.ChunkStartCycles = 0;
+    State.RunningChunk = SysTick_PlanChunk(&State, 0);
+    State.QueuedChunk = SysTick_PlanChunk(&State, State.RunningChunk);
 
-    /* Clear Counter By clearing Current register */
+    /* Load the first chunk, then queue the second one in the reload register */
+    SYSTICK_RELOAD_REG = State.RunningChunk - 1;
     SYSTICK_CURRENT_REG = 0;
 
+    g_SysTick_State[0] = State;
+    g_SysTick_State[1] = State;
+    g_SysTick_StateGeneration = 0;
+    g_SysTick_HandlerGeneration = 0xFFFFFFFF;
+
     /* In STRCTRL choose CLK_SRC = 1 , Enable = 1 and INTEN  = 1 for interrupt Enable */
     SYSTICK_CTRL_REG |= 0x07;
 
+    SYSTICK_RELOAD_REG = State.QueuedChunk - 1;
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_SetPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_PeriodMicroSeconds - New tick period in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the period is too short for the mode (the period is not changed)
+ * Description: Function to change the tick period without stopping the counter. The running tick
+ *              ends at its scheduled time and the next ticks use the new period from there, so
+ *              the phase is kept and no tick is lost or doubled.
+ ************************************************************************************/
+boolean SysTick_SetPeriod(uint64 a_PeriodMicroSeconds)
+{
+    SysTick_StateType State;
+    uint64 Period_Cycles;
+    uint32 Primask;
+    boolean Handler_Entered;
+
+    if(SysTick_PeriodToCycles(a_PeriodMicroSeconds, &Period_Cycles) == FALSE)
+    {
+        return FALSE;
+    }
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    SysTick_ReadState(&State);
+    State.PeriodCycles = Period_Cycles;
+
+    /* Called from an ISR preempting the SysTick handler before it published the wrap */
+    Handler_Entered = (g_SysTick_HandlerGeneration == g_SysTick_StateGeneration) ? TRUE : FALSE;
+
+    if(SYSTICK_CTRL_REG & STCTRL_ENABLE_BIT_MASK)
+    {
+        /* Do not race the counter re-load ... wait until it is far from zero or already re-loaded */
+        while((SYSTICK_CURRENT_REG < SYSTICK_RELOAD_GUARD_CYCLES) && (SysTick_IsChunkEnded(g_SysTick_StateGeneration) == FALSE));
+
+        /* If the queued chunk is not loaded yet plan it again with the new period, otherwise the
+         * pending or running handler plans the next chunk with it */
+        if(SysTick_IsChunkEnded(g_SysTick_StateGeneration) == FALSE)
+        {
+            State.QueuedChunk = SysTick_PlanChunk(&State, State.ChunkStartCycles + State.RunningChunk);
+            SYSTICK_RELOAD_REG = State.QueuedChunk - 1;
+        }
+    }
+
+    SysTick_PublishState(&State);
+
+    /* The new state does not account the wrap either, the exceptions are masked so no reader sees
+     * the mark move */
+    if(Handler_Entered == TRUE)
+    {
+        g_SysTick_HandlerGeneration = g_SysTick_StateGeneration;
+    }
+
+    NVIC_RestoreExceptions(Primask);
+
+    return TRUE;
 }
 
 
@@ -58,74 +342,159 @@ void SysTick_Init(uint16 a_TimeInMilliSeconds)
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Initialize the SysTick timer with the specified time in milliseconds
- *              using polling or busy-wait technique. The function should exit when the time is
- *              elapsed and stops the timer at the end.
+ * Description: Busy-wait the specified time in milliseconds using the SysTick counter.
+ *              A running timer is not re-programmed (the periodic interrupt keeps its period),
+ *              a stopped timer is started for the wait and stopped again at the end.
  ************************************************************************************/
 void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds)
 {
-    uint32 Reload_Value ;
-
-    /* Disable SysTick Timer at first */
-    SYSTICK_CTRL_REG = 0;
+    uint32 Saved_Ctrl;
+    uint32 Saved_Reload;
+    uint32 Saved_Current;
+    uint32 Previous_Value;
+    uint32 Current_Value;
+    uint32 Elapsed_Cycles = 0;
+    uint32 Cycles_Per_MilliSecond = Clock_GetSystemClock() / 1000;
+    uint64 Start_Cycles;
 
-    /* Calculate the reload value for the specified time in milliseconds */
-    Reload_Value = (16000000 / 1000) * a_TimeInMilliSeconds;
+    /* Read the current configuration to restore it at the end */
+    Saved_Ctrl = SYSTICK_CTRL_REG;
+    Saved_Reload = SYSTICK_RELOAD_REG;
+    Saved_Current = SYSTICK_CURRENT_REG;
 
-    /*Set in Reload Register Reload Value to set Timer to Count desired time */
-    SYSTICK_RELOAD_REG = Reload_Value - 1;
+    if(Saved_Ctrl & STCTRL_ENABLE_BIT_MASK)
+    {
+        /* A running timer is not re-programmed, the wait is measured on the uptime so the
+         * periodic interrupt keeps its period and phase */
+        Start_Cycles = SysTick_GetUptimeCycles();
+        while((SysTick_GetUptimeCycles() - Start_Cycles) < ((uint64)Cycles_Per_MilliSecond * a_TimeInMilliSeconds));
+        return;
+    }
 
-    /* Clear Counter By clearing Current register */
+    /* The timer is stopped ... run it free with the longest period and the interrupt disabled */
+    SYSTICK_RELOAD_REG = SYSTICK_MAX_RELOAD_VALUE;
     SYSTICK_CURRENT_REG = 0;
+    SYSTICK_CTRL_REG = STCTRL_CLK_SRC_BIT_MASK | STCTRL_ENABLE_BIT_MASK;
 
-    /* In STRCTRL choose CLK_SRC = 1 , Enable = 1 and INTEN  = 0 for interrupt Disable */
-    SYSTICK_CTRL_REG |= 0x05;
+    Previous_Value = SYSTICK_CURRENT_REG;
 
-    /* wait until the COUNT flag = 1
-       which mean SysTick Timer reaches ZERO value ...
-       COUNT flag is cleared after read the CTRL register value */
-    while(!(SYSTICK_CTRL_REG & (1<<SYSTICK_COUNT_FLAG)));
+    while(a_TimeInMilliSeconds != 0)
+    {
+        /* The counter counts down and re-loads at zero */
+        Current_Value = SYSTICK_CURRENT_REG;
+        if(Current_Value <= Previous_Value)
+        {
+            Elapsed_Cycles += Previous_Value - Current_Value;
+        }
+        else
+        {
+            Elapsed_Cycles += Previous_Value + (SYSTICK_MAX_CHUNK_CYCLES - Current_Value);
+        }
+        Previous_Value = Current_Value;
 
-    /* Stop The Timer*/
-    SysTick_Stop();
+        if(Elapsed_Cycles >= Cycles_Per_MilliSecond)
+        {
+            Elapsed_Cycles -= Cycles_Per_MilliSecond;
+            a_TimeInMilliSeconds--;
+        }
+    }
+
+    /* Restore the stopped timer at its position in the running chunk so SysTick_Start resumes the
+     * time base. A write only clears the counter ... the position is loaded from the reload register
+     * by a short run, a few cycles are lost, then the queued chunk is put back */
+    SYSTICK_CTRL_REG = Saved_Ctrl & STCTRL_CLK_SRC_BIT_MASK;
+    SYSTICK_CURRENT_REG = 0;
+    if(Saved_Current != 0)
+    {
+        SYSTICK_RELOAD_REG = Saved_Current;
+        SYSTICK_CTRL_REG = (Saved_Ctrl & STCTRL_CLK_SRC_BIT_MASK) | STCTRL_ENABLE_BIT_MASK;
+        while(SYSTICK_CURRENT_REG == 0);
+        SYSTICK_CTRL_REG = Saved_Ctrl & STCTRL_CLK_SRC_BIT_MASK;
+    }
+    SYSTICK_RELOAD_REG = Saved_Reload;
+    SYSTICK_CTRL_REG = Saved_Ctrl & (STCTRL_CLK_SRC_BIT_MASK | STCTRL_INTEN_BIT_MASK);
 }
 
 
 /************************************************************************************
- * Service Name: SysTick_Handler
- * Sync/Async: Asynchronous
- * Reentrancy: reentrant
+ * Service Name: SysTick_EnterInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
  * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Handler for SysTick interrupt use to call the call-back function.
+ * Description: Function to mark the published state as replaced by the running handler, called
+ *              first by the SysTick handler registered in the vector table (before ISR_STATS_ENTER).
+ *              Until SysTick_ProcessInterrupt publishes the wrap, a higher priority ISR reading the
+ *              uptime accounts the chunk that ended instead of going back in time.
  ************************************************************************************/
-void SysTick_Handler(void)
+void SysTick_EnterInterrupt(void)
 {
-    /* Check if the callback function pointer is not NULL */
-    if(*g_callBackPtr != NULL_PTR)
-    {
-        /* Call the callback function*/
-        (*g_callBackPtr)();
-    }
+    g_SysTick_HandlerGeneration = g_SysTick_StateGeneration;
 }
 
 
 /************************************************************************************
- * Service Name: SysTick_SetCallBack
+ * Service Name: SysTick_ProcessInterrupt
  * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if ticks elapsed since the last notification, FALSE at the end of an intermediate chunk
+ * Description: Function to account the chunk that ended and queue the next one, called by the
+ *              SysTick handler registered in the vector table after SysTick_EnterInterrupt.
+ ************************************************************************************/
+boolean SysTick_ProcessInterrupt(void)
+{
+    SysTick_StateType State;
+    boolean Tick_Elapsed;
+
+    SysTick_ReadState(&State);
+
+    /* The running chunk ended and the counter loaded the queued one */
+    State.ChunkStartCycles += State.RunningChunk;
+    State.RunningChunk = State.QueuedChunk;
+    SysTick_CountTicks(&State, State.ChunkStartCycles);
+
+    /* Queue the chunk following the one being counted */
+    State.QueuedChunk = SysTick_PlanChunk(&State, State.ChunkStartCycles + State.RunningChunk);
+    SYSTICK_RELOAD_REG = State.QueuedChunk - 1;
+
+    /* Intermediate chunks of a long period are not notified, the ticks counted on wake-up are */
+    Tick_Elapsed = (State.TickCount != State.NotifiedTickCount) ? TRUE : FALSE;
+    State.NotifiedTickCount = State.TickCount;
+
+    /* Count the elapsed ticks before the handler notifies the application */
+    SysTick_PublishState(&State);
+
+    return Tick_Elapsed;
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_Handler
+ * Sync/Async: Asynchronous
  * Reentrancy: reentrant
- * Parameters (in): pointer to Call Back function.
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description:  Function to setup the SysTick Timer call back to be executed in SysTick Handler.
+ * Description: Default handler for SysTick interrupt in the flash vector table, keeps the time base
+ *              without notifying the application. The application registers its own handler with
+ *              NVIC_RegisterHandler to be called directly on each tick.
  ************************************************************************************/
-void SysTick_SetCallBack(volatile void (*Ptr2Func) (void))
+void SysTick_Handler(void)
 {
-    /* Set the global callback function pointer to the provided function pointer */
-    g_callBackPtr = Ptr2Func;
+    SysTick_EnterInterrupt();
+
+    /* Measure the latency before the next reload value is queued */
+    ISR_STATS_ENTER();
+
+    (void)SysTick_ProcessInterrupt();
+
+    ISR_STATS_EXIT();
 }
 
 
@@ -178,3 +547,244 @@ void SysTick_DeInit(void)
     /* Disable SysTick Timer Setting By Setting control register to Zero */
     SYSTICK_CTRL_REG = 0;
 }
+
+
+/************************************************************************************
+ * Service Name: SysTick_GetTickCount
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of SysTick periods elapsed since SysTick_Init
+ * Description:  Function to get the number of ticks elapsed since the SysTick timer was initialized,
+ *               ticks skipped by SysTick_SleepUntil are included.
+ ************************************************************************************/
+uint32 SysTick_GetTickCount(void)
+{
+    return (uint32)g_SysTick_State[g_SysTick_StateGeneration & 1].TickCount;
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_SleepUntil
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_WakeUpTick - Tick count at which the next activity is due
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description:  Tickless idle ... Function to put the processor to sleep until the specified tick
+ *               or until any other interrupt occurs. The SysTick interrupt is re-programmed to fire
+ *               at the wake-up tick instead of every period, and the tick count is corrected on
+ *               wake-up so the time base does not drift. Must be called from thread mode,
+ *               with the interrupts disabled if the wake-up tick can be changed by an ISR (the
+ *               interrupts are enabled on return).
+ ************************************************************************************/
+void SysTick_SleepUntil(uint32 a_WakeUpTick)
+{
+    SysTick_StateType State;
+    uint32 Idle_Ticks;
+    uint32 Reload_Value;
+    uint32 Current_Value;
+    uint32 Sleep_Frequency;
+    uint64 Now_Cycles;
+    uint64 Sleep_Cycles;
+    boolean Ticks_Reached;
+
+    /* Interrupts stay masked until the time base is corrected, WFI still wakes up on a pending interrupt */
+    Disable_Exceptions();
+
+    SysTick_ReadState(&State);
+    Idle_Ticks = a_WakeUpTick - (uint32)State.TickCount;
+
+    /* The deadline is already reached ... return so the caller can handle it */
+    if((sint32)Idle_Ticks <= 0)
+    {
+        Enable_Exceptions();
+        return;
+    }
+
+    /* Nothing to skip if the timer is stopped, or if the next tick is the deadline and the timer keeps counting
+     * the system clock while sleeping ... just sleep until the next interrupt. In Deep-Sleep the running chunk
+     * would count the slower sleep clock, the next tick is re-programmed like a longer sleep */
+    if(!(SYSTICK_CTRL_REG & STCTRL_ENABLE_BIT_MASK) ||
+       ((Idle_Ticks <= 1) && (Power_GetSleepClockFrequency() == g_SysTick_ClockFrequency)))
+    {
+        Data_Sync_Barrier();
+        Wait_For_Interrupt();
+        Instruction_Sync_Barrier();
+        Enable_Exceptions();
+        return;
+    }
+
+    /* Stop the timer to re-program it, the position in the running chunk is kept in the current register */
+    SYSTICK_CTRL_REG &= ~STCTRL_ENABLE_BIT_MASK;
+
+    /* A chunk ended before the timer was stopped and its handler is still pending ... abort the sleep */
+    if(NVIC_SYSTEM_INTCTRL & SYSTICK_PEND_BIT_MASK)
+    {
+        SYSTICK_CTRL_REG |= STCTRL_ENABLE_BIT_MASK;
+        Enable_Exceptions();
+        return;
+    }
+
+    Current_Value = SYSTICK_CURRENT_REG;
+    if(Current_Value >= State.RunningChunk)
+    {
+        Current_Value = State.RunningChunk - 1;
+    }
+    Now_Cycles = State.ChunkStartCycles + ((State.RunningChunk - 1) - Current_Value);
+
+    /* Tick boundaries passed during the last sleep are not counted yet, the short chunk running after
+     * the wake-up counts them ... sleeping now would run past them */
+    if(Now_Cycles >= State.NextTickCycles)
+    {
+        SYSTICK_CTRL_REG |= STCTRL_ENABLE_BIT_MASK;
+        Enable_Exceptions();
+        return;
+    }
+
+    /* The SysTick counts the sleep clock while sleeping (the PIOSC in Deep-Sleep), the sleep reload is
+     * calculated in sleep clock cycles and converted back to system clock cycles on wake-up */
+    Sleep_Frequency = Power_GetSleepClockFrequency();
+
+    /* Fire the interrupt at the wake-up tick boundary, the 24-bit counter limits one sleep */
+    Sleep_Cycles = (State.NextTickCycles + ((uint64)(Idle_Ticks - 1) * State.PeriodCycles)) - Now_Cycles;
+    if(Sleep_Cycles > SYSTICK_MAX_CHUNK_CYCLES)
+    {
+        Sleep_Cycles = SYSTICK_MAX_CHUNK_CYCLES;
+    }
+    Reload_Value = SysTick_ScaleCycles((uint32)Sleep_Cycles - 1, Sleep_Frequency, g_SysTick_ClockFrequency);
+    if(Reload_Value > (2 * SYSTICK_STOPPED_TIMER_COMPENSATION))
+    {
+        Reload_Value -= SysTick_ScaleCycles(SYSTICK_STOPPED_TIMER_COMPENSATION, Sleep_Frequency, g_SysTick_ClockFrequency);
+    }
+    else
+    {
+        /* Too close to the wake-up tick to be worth it */
+        SYSTICK_CTRL_REG |= STCTRL_ENABLE_BIT_MASK;
+        Enable_Exceptions();
+        return;
+    }
+
+    SYSTICK_RELOAD_REG = Reload_Value;
+    SYSTICK_CURRENT_REG = 0;
+    SYSTICK_CTRL_REG |= STCTRL_ENABLE_BIT_MASK;
+
+    /* Sleep ... Sleep or Deep-Sleep is selected by the SLEEPDEEP bit in the System Control register */
+    Data_Sync_Barrier();
+    Wait_For_Interrupt();
+    Instruction_Sync_Barrier();
+
+    /* Stop the timer again to calculate the time spent in sleep */
+    SYSTICK_CTRL_REG &= ~STCTRL_ENABLE_BIT_MASK;
+
+    if(NVIC_SYSTEM_INTCTRL & SYSTICK_PEND_BIT_MASK)
+    {
+        /* Woken up by the SysTick at the wake-up tick, the counter already re-loaded the sleep value
+         * and counted at the system clock since the wake-up. The wrap is accounted here */
+        NVIC_SYSTEM_INTCTRL = SYSTICK_UNPEND_BIT_MASK;
+        Now_Cycles += SysTick_ScaleCycles(Reload_Value + 1, g_SysTick_ClockFrequency, Sleep_Frequency)
+                      + (Reload_Value - SYSTICK_CURRENT_REG);
+    }
+    else
+    {
+        /* Woken up by another interrupt */
+        Now_Cycles += SysTick_ScaleCycles(Reload_Value - SYSTICK_CURRENT_REG, g_SysTick_ClockFrequency, Sleep_Frequency);
+    }
+    Now_Cycles += SYSTICK_STOPPED_TIMER_COMPENSATION;
+
+    /* Restart the chunks from the current position. If tick boundaries were reached during the sleep
+     * they are counted now, so the ISR that woke up the processor reads the current tick count, and a
+     * short chunk is used so the handler notifies the application right away */
+    Ticks_Reached = (Now_Cycles >= State.NextTickCycles) ? TRUE : FALSE;
+    SysTick_CountTicks(&State, Now_Cycles);
+    State.ChunkStartCycles = Now_Cycles;
+    State.RunningChunk = (Ticks_Reached == TRUE) ? SYSTICK_MIN_CHUNK_CYCLES : SysTick_PlanChunk(&State, Now_Cycles);
+    SYSTICK_RELOAD_REG = State.RunningChunk - 1;
+    SYSTICK_CURRENT_REG = 0;
+    SYSTICK_CTRL_REG |= STCTRL_ENABLE_BIT_MASK;
+
+    /* The counter already loaded the running chunk, queue the next one */
+    State.QueuedChunk = SysTick_PlanChunk(&State, Now_Cycles + State.RunningChunk);
+    SYSTICK_RELOAD_REG = State.QueuedChunk - 1;
+
+    SysTick_PublishState(&State);
+
+    /* Enable Interrupts so the handler of the interrupt that woke up the processor is executed */
+    Enable_Exceptions();
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_GetUptimeTicks
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint64 - Number of SysTick periods elapsed since SysTick_Init
+ * Description:  Function to get the monotonic 64-bit tick count, a tick elapsed while its handler is
+ *               pending is included. Consistent from thread mode and from any ISR without masking.
+ ************************************************************************************/
+uint64 SysTick_GetUptimeTicks(void)
+{
+    SysTick_StateType State;
+    uint64 Now_Cycles;
+
+    Now_Cycles = SysTick_SampleCycles(&State);
+    SysTick_CountTicks(&State, Now_Cycles);
+
+    return State.TickCount;
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_GetUptimeCycles
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint64 - Number of system clock cycles elapsed since SysTick_Init
+ * Description:  Function to get the monotonic 64-bit uptime in system clock cycles.
+ ************************************************************************************/
+uint64 SysTick_GetUptimeCycles(void)
+{
+    SysTick_StateType State;
+
+    return SysTick_SampleCycles(&State);
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_GetUptimeUs
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint64 - Number of micro-seconds elapsed since SysTick_Init
+ * Description:  Function to get the monotonic 64-bit uptime in micro-seconds.
+ ************************************************************************************/
+uint64 SysTick_GetUptimeUs(void)
+{
+    return SysTick_GetUptimeCycles() / (g_SysTick_ClockFrequency / 1000000);
+}
+
+
+/************************************************************************************
+ * Service Name: SysTick_GetUptimeMs
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint64 - Number of milli-seconds elapsed since SysTick_Init
+ * Description:  Function to get the monotonic 64-bit uptime in milli-seconds.
+ ************************************************************************************/
+uint64 SysTick_GetUptimeMs(void)
+{
+    return SysTick_GetUptimeCycles() / (g_SysTick_ClockFrequency / 1000);
+}
@@ -16,7 +16,32 @@
  *                           Preprocessor Definitions                          *
  *******************************************************************************/
 #define STCTRL_ENABLE_BIT_MASK    0x00000001
+#define STCTRL_INTEN_BIT_MASK     0x00000002
+#define STCTRL_CLK_SRC_BIT_MASK   0x00000004
 #define SYSTICK_COUNT_FLAG        16
+
+/* The SysTick counter is 24-bits wide, longer periods are counted in several chunks */
+#define SYSTICK_MAX_RELOAD_VALUE  0x00FFFFFF
+#define SYSTICK_MAX_CHUNK_CYCLES  (SYSTICK_MAX_RELOAD_VALUE + 1)
+
+/* Shortest chunk, leaves the handler enough time to queue the next reload value before it is loaded */
+#define SYSTICK_MIN_CHUNK_CYCLES  400
+
+/* SysTick_SetPeriod does not write the reload value this close to the counter re-load */
+#define SYSTICK_RELOAD_GUARD_CYCLES   64
+
+/* Number of SysTick clock cycles lost while the timer is stopped to be re-programmed
+ * by SysTick_SleepUntil, it is added back when the sleep period is calculated */
+#define SYSTICK_STOPPED_TIMER_COMPENSATION   45
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    SYSTICK_MODE_EXACT,            /* The handler runs at the end of every tick period */
+    SYSTICK_MODE_MIN_INTERRUPTS    /* Short periods are grouped, the handler counts several ticks at once */
+}SysTick_ModeType;
+
 /*******************************************************************************
  *                      Functions Prototypes                                   *
  *******************************************************************************/
@@ -30,11 +55,45 @@
 * Return value: None
 * Description: Initialize the SysTick timer with the specified time in milliseconds
 *              using interrupts. This function is used to setup the timer to generate periodic
-*              interrupts every specified time in milliseconds.
+*              interrupts every specified time in milliseconds. The reload value is calculated
+*              from the current system clock, so it must be called after Clock_Init.
 ************************************************************************************/
 void SysTick_Init(uint16 a_TimeInMilliSeconds);
 
 
+/************************************************************************************
+* Service Name: SysTick_InitPeriod
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): a_PeriodMicroSeconds - Tick period in micro-seconds, from micro-seconds to hours
+*                , a_Mode - SYSTICK_MODE_EXACT: the handler runs at the end of every period, periods
+*                           longer than the 24-bit counter are split in equal chunks
+*                           SYSTICK_MODE_MIN_INTERRUPTS: short periods are grouped so the handler runs
+*                           at most once per counter range (about 0.2 s at 80 MHz) and counts all of them
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the period is too short for the mode
+* Description: Initialize the SysTick timer with any tick period by extending the 24-bit counter in
+*              software, the periods are exact in both modes. Must be called after Clock_Init.
+************************************************************************************/
+boolean SysTick_InitPeriod(uint64 a_PeriodMicroSeconds, SysTick_ModeType a_Mode);
+
+
+/************************************************************************************
+* Service Name: SysTick_SetPeriod
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_PeriodMicroSeconds - New tick period in micro-seconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the period is too short for the mode (the period is not changed)
+* Description: Function to change the tick period without stopping the counter. The running tick
+*              ends at its scheduled time and the next ticks use the new period from there, so
+*              the phase is kept and no tick is lost or doubled.
+************************************************************************************/
+boolean SysTick_SetPeriod(uint64 a_PeriodMicroSeconds);
+
+
 /************************************************************************************
 * Service Name: SysTick_StartBusyWait
 * Sync/Async: Synchronous
@@ -43,37 +102,56 @@ void SysTick_Init(uint16 a_TimeInMilliSeconds);
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Initialize the SysTick timer with the specified time in milliseconds
-*              using polling or busy-wait technique. The function should exit when the time is
-*              elapsed and stops the timer at the end.
+* Description: Busy-wait the specified time in milliseconds using the SysTick counter.
+*              A running timer is not re-programmed (the periodic interrupt keeps its period),
+*              a stopped timer is started for the wait and stopped again at the end.
 ************************************************************************************/
 void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds);
 
 
 /************************************************************************************
-* Service Name: SysTick_Handler
-* Sync/Async: Asynchronous
-* Reentrancy: reentrant
+* Service Name: SysTick_EnterInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
 * Parameters (in): None
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Handler for SysTick interrupt use to call the call-back function.
+* Description: Function to mark the published state as replaced by the running handler, called
+*              first by the SysTick handler registered in the vector table (before ISR_STATS_ENTER).
+*              Until SysTick_ProcessInterrupt publishes the wrap, a higher priority ISR reading the
+*              uptime accounts the chunk that ended instead of going back in time.
 ************************************************************************************/
-void SysTick_Handler(void);
+void SysTick_EnterInterrupt(void);
 
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_ProcessInterrupt
 * Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if ticks elapsed since the last notification, FALSE at the end of an intermediate chunk
+* Description: Function to account the chunk that ended and queue the next one, called by the
+*              SysTick handler registered in the vector table after SysTick_EnterInterrupt.
+************************************************************************************/
+boolean SysTick_ProcessInterrupt(void);
+
+
+/************************************************************************************
+* Service Name: SysTick_Handler
+* Sync/Async: Asynchronous
 * Reentrancy: reentrant
-* Parameters (in): pointer to Call Back function.
+* Parameters (in): None
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description:  Function to setup the SysTick Timer call back to be executed in SysTick Handler.
+* Description: Default handler for SysTick interrupt in the flash vector table, keeps the time base
+*              without notifying the application. The application registers its own handler with
+*              NVIC_RegisterHandler to be called directly on each tick.
 ************************************************************************************/
-void SysTick_SetCallBack(volatile void (*Ptr2Func) (void));
+void SysTick_Handler(void);
 
 
 /************************************************************************************
@@ -114,4 +192,89 @@ void SysTick_Start(void);
 ************************************************************************************/
 void SysTick_DeInit(void);
 
+
+/************************************************************************************
+* Service Name: SysTick_GetTickCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of SysTick periods elapsed since SysTick_Init
+* Description:  Function to get the number of ticks elapsed since the SysTick timer was initialized,
+*               ticks skipped by SysTick_SleepUntil are included.
+************************************************************************************/
+uint32 SysTick_GetTickCount(void);
+
+
+/************************************************************************************
+* Service Name: SysTick_SleepUntil
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_WakeUpTick - Tick count at which the next activity is due
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description:  Tickless idle ... Function to put the processor to sleep until the specified tick
+*               or until any other interrupt occurs. The SysTick interrupt is re-programmed to fire
+*               at the wake-up tick instead of every period, and the tick count is corrected on
+*               wake-up so the time base does not drift. Must be called from thread mode,
+*               with the interrupts disabled if the wake-up tick can be changed by an ISR (the
+*               interrupts are enabled on return).
+************************************************************************************/
+void SysTick_SleepUntil(uint32 a_WakeUpTick);
+
+
+/************************************************************************************
+* Service Name: SysTick_GetUptimeTicks
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Number of SysTick periods elapsed since SysTick_Init
+* Description:  Function to get the monotonic 64-bit tick count, a tick elapsed while its handler is
+*               pending is included. Consistent from thread mode and from any ISR without masking.
+************************************************************************************/
+uint64 SysTick_GetUptimeTicks(void);
+
+
+/************************************************************************************
+* Service Name: SysTick_GetUptimeCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Number of system clock cycles elapsed since SysTick_Init
+* Description:  Function to get the monotonic 64-bit uptime in system clock cycles.
+************************************************************************************/
+uint64 SysTick_GetUptimeCycles(void);
+
+
+/************************************************************************************
+* Service Name: SysTick_GetUptimeUs
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Number of micro-seconds elapsed since SysTick_Init
+* Description:  Function to get the monotonic 64-bit uptime in micro-seconds.
+************************************************************************************/
+uint64 SysTick_GetUptimeUs(void);
+
+
+/************************************************************************************
+* Service Name: SysTick_GetUptimeMs
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Number of milli-seconds elapsed since SysTick_Init
+* Description:  Function to get the monotonic 64-bit uptime in milli-seconds.
+************************************************************************************/
+uint64 SysTick_GetUptimeMs(void);
+
 #endif /* SYSTICK_H_ */
@@ -0,0 +1,296 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Uart0.c                                                                   *
+ * [DESCRIPTION]    :           Source file for the UART0 driver - interrupt RX and uDMA TX               *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Uart0.h"
+#include "Clock.h"
+#include "NVIC.h"
+#include "EventRing.h"
+#include "Udma.h"
+#include "IsrStats.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Buffer given to Uart0_Write, sent by chunks of UART0_DMA_MAX_TRANSFER bytes */
+static const uint8 *g_Uart0_TxNext = NULL_PTR;
+static uint32 g_Uart0_TxRemaining = 0;
+static volatile boolean g_Uart0_TxBusy = FALSE;
+
+/* UART0 ISR is the producer and Uart0_ReadByte is the consumer */
+static uint8 g_Uart0_RxBuffer[UART0_RX_BUFFER_SIZE];
+static EventRing_Type g_Uart0_RxRing;
+static volatile uint32 g_Uart0_RxErrors = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* Program and enable the uDMA channel for the next chunk of the TX buffer */
+static void Uart0_StartTxChunk(void)
+{
+    uint32 Length = (g_Uart0_TxRemaining > UART0_DMA_MAX_TRANSFER) ? UART0_DMA_MAX_TRANSFER : g_Uart0_TxRemaining;
+
+    /* Bytes to the data register (not incremented), 4 bytes per request to fill the TX FIFO level */
+    Udma_SetTransfer(UART0_TX_DMA_CHANNEL, UDMA_PRIMARY, UDMA_MODE_BASIC,
+                     UDMA_CONTROL(UDMA_INC_NONE, UDMA_INC_8, UDMA_SIZE_8, UDMA_ARB_4),
+                     g_Uart0_TxNext, &UART0_DR_REG, Length);
+
+    g_Uart0_TxNext += Length;
+    g_Uart0_TxRemaining -= Length;
+
+    Udma_EnableChannel(UART0_TX_DMA_CHANNEL);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Uart0_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_BaudRate - Baud rate in bits per second, 8 data bits, no parity and 1 stop bit
+ *                , a_TxLevel - TX FIFO free space requesting a uDMA burst
+ *                , a_RxLevel - RX FIFO level raising the receive interrupt
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initialize UART0 on PA0/PA1 with the FIFOs enabled, the received bytes are buffered by
+ *              the interrupt and the transmission is done by uDMA. Must be called after Clock_Init
+ *              and Udma_Init.
+ ************************************************************************************/
+void Uart0_Init(uint32 a_BaudRate, Uart0_FifoLevelType a_TxLevel, Uart0_FifoLevelType a_RxLevel)
+{
+    uint32 Divisor;
+
+    EventRing_Init(&g_Uart0_RxRing, g_Uart0_RxBuffer, sizeof(uint8), UART0_RX_BUFFER_SIZE);
+    g_Uart0_RxErrors = 0;
+    g_Uart0_TxBusy = FALSE;
+
+    /* Enable clock for UART0 and PORTA and wait for the clocks to start */
+    SYSCTL_RCGCUART_REG |= UART0_CLOCK_MASK;
+    SYSCTL_RCGCGPIO_REG |= UART0_GPIO_PORTA_CLOCK_MASK;
+    while(!(SYSCTL_PRUART_REG & UART0_CLOCK_MASK));
+    while(!(SYSCTL_PRGPIO_REG & UART0_GPIO_PORTA_CLOCK_MASK));
+
+    GPIO_PORTA_AMSEL_REG &= ~UART0_PINS_MASK;    /* Disable Analog on PA0 and PA1 */
+    GPIO_PORTA_AFSEL_REG |= UART0_PINS_MASK;     /* Enable alternative function on PA0 and PA1 */
+    GPIO_PORTA_PCTL_REG   = (GPIO_PORTA_PCTL_REG & ~UART0_PCTL_MASK) | UART0_PCTL_VALUE; /* U0Rx and U0Tx */
+    GPIO_PORTA_DEN_REG   |= UART0_PINS_MASK;     /* Enable Digital I/O on PA0 and PA1 */
+
+    /* Disable the UART while it is configured */
+    UART0_CTL_REG = 0;
+
+    /* Baud rate divisor = clock / (16 * baud) with 6 fractional bits, rounded to the nearest */
+    Divisor = (uint32)((((uint64)Clock_GetSystemClock() * 8) / a_BaudRate + 1) / 2);
+    UART0_IBRD_REG = Divisor >> 6;
+    UART0_FBRD_REG = Divisor & 0x3F;
+
+    /* The divisor is updated by the write of the line control register */
+    UART0_LCRH_REG = UART_LCRH_WLEN_8_BITS | UART_LCRH_FEN_BIT_MASK;
+    UART0_IFLS_REG = (uint32)a_TxLevel | ((uint32)a_RxLevel << UART_IFLS_RX_BITS_POS);
+
+    /* Receive (FIFO level), receive timeout (bytes left below the level) and overrun interrupts */
+    UART0_ICR_REG = 0xFFFFFFFF;
+    UART0_IM_REG = UART_INT_RX_BIT_MASK | UART_INT_RT_BIT_MASK | UART_INT_OE_BIT_MASK;
+    UART0_DMACTL_REG = UART_DMACTL_TXDMAE_BIT_MASK;
+
+    /* uDMA channel 9 assigned to UART0 TX */
+    Udma_AllocateChannel(UART0_TX_DMA_CHANNEL, UART0_TX_DMA_ENCODING);
+
+    UART0_CTL_REG = UART_CTL_UARTEN_BIT_MASK | UART_CTL_TXE_BIT_MASK | UART_CTL_RXE_BIT_MASK;
+
+    /* Enable NVIC UART0 IRQ and set its priority, it also signals the end of the uDMA transfers */
+    NVIC_EnableIRQ(UART0_IRQ_NUM);
+    NVIC_SetPriorityIRQ(UART0_IRQ_NUM, UART0_INTERRUPT_PRIORITY);
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_Write
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Data - Bytes to send, not copied ... must not change until the transmission is done
+ *                , a_Length - Number of bytes
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if a transmission is in progress
+ * Description: Function to send a buffer by uDMA, the CPU is only interrupted every 1024 bytes.
+ ************************************************************************************/
+boolean Uart0_Write(const uint8 *a_Data, uint32 a_Length)
+{
+    if(g_Uart0_TxBusy == TRUE)
+    {
+        return FALSE;
+    }
+
+    if(a_Length == 0)
+    {
+        return TRUE;
+    }
+
+    g_Uart0_TxNext = a_Data;
+    g_Uart0_TxRemaining = a_Length;
+    g_Uart0_TxBusy = TRUE;
+
+    /* The UART0 interrupt is raised at the end of the chunk, the handler starts the next one */
+    Uart0_StartTxChunk();
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_IsTxBusy
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE while the buffer given to Uart0_Write is in use
+ * Description: Function to check if the uDMA transmission is in progress.
+ ************************************************************************************/
+boolean Uart0_IsTxBusy(void)
+{
+    return g_Uart0_TxBusy;
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_SendString
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_String - Null terminated string
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to send a string through the TX FIFO by polling, waits for the uDMA
+ *              transmission in progress first and returns when the last byte is sent on the line.
+ *              For short messages and buffers that are reused at once.
+ ************************************************************************************/
+void Uart0_SendString(const char *a_String)
+{
+    while(g_Uart0_TxBusy == TRUE);
+
+    while(*a_String != '\0')
+    {
+        /* Wait until there is space in the TX FIFO */
+        while(UART0_FR_REG & UART_FR_TXFF_BIT_MASK);
+        UART0_DR_REG = (uint8)*a_String;
+        a_String++;
+    }
+
+    /* Return once the last byte has left the shift register, the caller may stop the UART clock */
+    while(UART0_FR_REG & UART_FR_BUSY_BIT_MASK);
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_IsTxDrained
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE when no uDMA transmission is in progress and the TX FIFO and the
+ *                         shift register are empty
+ * Description: Function to check if all the bytes given to the driver are sent on the line, the
+ *              UART clock must not be stopped (Deep-Sleep) before.
+ ************************************************************************************/
+boolean Uart0_IsTxDrained(void)
+{
+    return ((g_Uart0_TxBusy == FALSE) && !(UART0_FR_REG & UART_FR_BUSY_BIT_MASK)) ? TRUE : FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_ReadByte
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): a_Byte - Oldest received byte
+ * Return value: boolean - FALSE if no byte is received
+ * Description: Function to read a received byte without blocking.
+ ************************************************************************************/
+boolean Uart0_ReadByte(uint8 *a_Byte)
+{
+    return EventRing_Pop(&g_Uart0_RxRing, a_Byte);
+}
+
+
+/************************************************************************************
+ * Service Name: Uart0_GetRxErrors
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Bytes lost by a FIFO overrun, a full buffer or a framing/parity/break error
+ * Description: Function to get the number of received bytes lost since Uart0_Init.
+ ************************************************************************************/
+uint32 Uart0_GetRxErrors(void)
+{
+    return g_Uart0_RxErrors;
+}
+
+
+/************************************************************************************
+ * Service Name: UART0_Handler
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Handler for UART0 interrupt, empties the RX FIFO and continues or ends the uDMA
+ *              transmission.
+ ************************************************************************************/
+void UART0_Handler(void)
+{
+    uint32 Status;
+    uint32 Data;
+    uint8 Byte;
+
+    ISR_STATS_ENTER();
+
+    Status = UART0_MIS_REG;
+    UART0_ICR_REG = Status;
+
+    if(Status & UART_INT_OE_BIT_MASK)
+    {
+        g_Uart0_RxErrors++;
+    }
+
+    /* Empty the RX FIFO on the level and on the timeout */
+    while(!(UART0_FR_REG & UART_FR_RXFE_BIT_MASK))
+    {
+        Data = UART0_DR_REG;
+        Byte = (uint8)(Data & UART_DR_DATA_MASK);
+        if((Data & UART_DR_ERRORS_MASK) || (EventRing_Push(&g_Uart0_RxRing, &Byte) == FALSE))
+        {
+            g_Uart0_RxErrors++;
+        }
+    }
+
+    /* The uDMA disables the channel at the end of the transfer and raises the UART0 interrupt */
+    if((g_Uart0_TxBusy == TRUE) && (Udma_IsChannelEnabled(UART0_TX_DMA_CHANNEL) == FALSE))
+    {
+        Udma_ClearInterrupt(UART0_TX_DMA_CHANNEL);
+
+        if(g_Uart0_TxRemaining != 0)
+        {
+            Uart0_StartTxChunk();
+        }
+        else
+        {
+            g_Uart0_TxBusy = FALSE;
+        }
+    }
+
+    ISR_STATS_EXIT();
+}
@@ -0,0 +1,179 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Uart0.h                                                                   *
+ * [DESCRIPTION]    :           Header file for the UART0 driver - interrupt RX and uDMA TX               *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef UART0_H_
+#define UART0_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+/* UART0 uses PA0 (U0Rx) and PA1 (U0Tx), the virtual COM port of the LaunchPad */
+#define UART0_IRQ_NUM                 5
+#define UART0_INTERRUPT_PRIORITY      3
+#define UART0_GPIO_PORTA_CLOCK_MASK   0x01
+#define UART0_CLOCK_MASK              0x01
+#define UART0_PINS_MASK               0x03
+#define UART0_PCTL_MASK               0x000000FF
+#define UART0_PCTL_VALUE              0x00000011
+
+/* Received bytes buffered until read by the application, must be a power of 2 */
+#define UART0_RX_BUFFER_SIZE          64
+
+/* uDMA channel 9 is UART0 TX (channel map encoding 0), one transfer moves up to 1024 bytes */
+#define UART0_TX_DMA_CHANNEL          9
+#define UART0_TX_DMA_ENCODING         0
+#define UART0_DMA_MAX_TRANSFER        1024
+
+/* UART registers bits */
+#define UART_FR_BUSY_BIT_MASK         0x00000008
+#define UART_FR_RXFE_BIT_MASK         0x00000010
+#define UART_FR_TXFF_BIT_MASK         0x00000020
+#define UART_LCRH_FEN_BIT_MASK        0x00000010
+#define UART_LCRH_WLEN_8_BITS         0x00000060
+#define UART_CTL_UARTEN_BIT_MASK      0x00000001
+#define UART_CTL_TXE_BIT_MASK         0x00000100
+#define UART_CTL_RXE_BIT_MASK         0x00000200
+#define UART_INT_RX_BIT_MASK          0x00000010
+#define UART_INT_RT_BIT_MASK          0x00000040
+#define UART_INT_OE_BIT_MASK          0x00000400
+#define UART_DR_DATA_MASK             0x000000FF
+#define UART_DR_ERRORS_MASK           0x00000F00
+#define UART_DMACTL_TXDMAE_BIT_MASK   0x00000002
+#define UART_IFLS_RX_BITS_POS         3
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+/* FIFO level triggering the TX (free space) and RX (received bytes) requests, in sixteenths */
+typedef enum
+{
+    UART0_FIFO_LEVEL_2_16,
+    UART0_FIFO_LEVEL_4_16,
+    UART0_FIFO_LEVEL_8_16,
+    UART0_FIFO_LEVEL_12_16,
+    UART0_FIFO_LEVEL_14_16
+}Uart0_FifoLevelType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Uart0_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_BaudRate - Baud rate in bits per second, 8 data bits, no parity and 1 stop bit
+*                , a_TxLevel - TX FIFO free space requesting a uDMA burst
+*                , a_RxLevel - RX FIFO level raising the receive interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Initialize UART0 on PA0/PA1 with the FIFOs enabled, the received bytes are buffered by
+*              the interrupt and the transmission is done by uDMA. Must be called after Clock_Init
+*              and Udma_Init.
+************************************************************************************/
+void Uart0_Init(uint32 a_BaudRate, Uart0_FifoLevelType a_TxLevel, Uart0_FifoLevelType a_RxLevel);
+
+
+/************************************************************************************
+* Service Name: Uart0_Write
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Data - Bytes to send, not copied ... must not change until the transmission is done
+*                , a_Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if a transmission is in progress
+* Description: Function to send a buffer by uDMA, the CPU is only interrupted every 1024 bytes.
+************************************************************************************/
+boolean Uart0_Write(const uint8 *a_Data, uint32 a_Length);
+
+
+/************************************************************************************
+* Service Name: Uart0_IsTxBusy
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE while the buffer given to Uart0_Write is in use
+* Description: Function to check if the uDMA transmission is in progress.
+************************************************************************************/
+boolean Uart0_IsTxBusy(void);
+
+
+/************************************************************************************
+* Service Name: Uart0_SendString
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_String - Null terminated string
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to send a string through the TX FIFO by polling, waits for the uDMA
+*              transmission in progress first and returns when the last byte is sent on the line.
+*              For short messages and buffers that are reused at once.
+************************************************************************************/
+void Uart0_SendString(const char *a_String);
+
+
+/************************************************************************************
+* Service Name: Uart0_IsTxDrained
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when no uDMA transmission is in progress and the TX FIFO and the
+*                         shift register are empty
+* Description: Function to check if all the bytes given to the driver are sent on the line, the
+*              UART clock must not be stopped (Deep-Sleep) before.
+************************************************************************************/
+boolean Uart0_IsTxDrained(void);
+
+
+/************************************************************************************
+* Service Name: Uart0_ReadByte
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): a_Byte - Oldest received byte
+* Return value: boolean - FALSE if no byte is received
+* Description: Function to read a received byte without blocking.
+************************************************************************************/
+boolean Uart0_ReadByte(uint8 *a_Byte);
+
+
+/************************************************************************************
+* Service Name: Uart0_GetRxErrors
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Bytes lost by a FIFO overrun, a full buffer or a framing/parity/break error
+* Description: Function to get the number of received bytes lost since Uart0_Init.
+************************************************************************************/
+uint32 Uart0_GetRxErrors(void);
+
+
+/************************************************************************************
+* Service Name: UART0_Handler
+* Sync/Async: Asynchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler for UART0 interrupt, empties the RX FIFO and continues or ends the uDMA
+*              transmission.
+************************************************************************************/
+void UART0_Handler(void);
+
+#endif /* UART0_H_ */
@@ -0,0 +1,427 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Udma.c                                                                    *
+ * [DESCRIPTION]    :           Source file for the micro direct memory access (uDMA) driver              *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Udma.h"
+#include "NVIC.h"
+#include "tm4c123gh6pm_registers.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define UDMA_CHANNEL_MASK(CHANNEL)    ((uint32)1 << (CHANNEL))
+
+/* Each channel map register holds the 4-bit encoding of 8 channels */
+#define UDMA_CHMAP_CHANNELS           8
+#define UDMA_CHMAP_FIELD_MASK         0xF
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Primary structures of the 32 channels then their alternate structures, the section is aligned
+ * to 1024 bytes by the linker command file */
+#pragma DATA_SECTION(g_Udma_ControlTable, ".udma_table")
+static Udma_ChannelControlType g_Udma_ControlTable[2 * UDMA_CHANNELS_COUNT];
+
+static uint32 g_Udma_AllocatedChannels = 0;
+
+static volatile boolean g_Udma_MemoryBusy = FALSE;
+
+/* Source of Udma_Fill, the byte is repeated for the 32-bit items */
+static volatile uint32 g_Udma_FillValue = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* End address of a source or a destination ... the last item, or the fixed address */
+static uint32 Udma_EndAddress(const volatile void *a_Start, uint32 a_Increment, uint32 a_Count)
+{
+    if(a_Increment == UDMA_INC_NONE)
+    {
+        return (uint32)a_Start;
+    }
+
+    return (uint32)a_Start + ((a_Count - 1) << a_Increment);
+}
+
+/* Fill a control structure from the control word built by UDMA_CONTROL */
+static void Udma_FillStructure(Udma_ChannelControlType *a_Structure, Udma_ModeType a_Mode, uint32 a_Control,
+                               const volatile void *a_Source, volatile void *a_Destination, uint32 a_Count)
+{
+    a_Structure->SourceEnd = Udma_EndAddress(a_Source, (a_Control >> UDMA_CHCTL_SRCINC_BITS_POS) & 0x3, a_Count);
+    a_Structure->DestinationEnd = Udma_EndAddress(a_Destination, (a_Control >> UDMA_CHCTL_DSTINC_BITS_POS) & 0x3, a_Count);
+    a_Structure->Control = a_Control | ((a_Count - 1) << UDMA_CHCTL_XFERSIZE_BITS_POS) | (uint32)a_Mode;
+}
+
+/* Memory to memory transfer on the software channel, by chunks of UDMA_MAX_TRANSFER_ITEMS items */
+static boolean Udma_MemoryTransfer(void *a_Destination, const volatile void *a_Source, boolean a_SourceFixed, uint32 a_Length)
+{
+    uint32 Primask;
+    uint32 Control;
+    uint32 Items;
+    uint32 Chunk;
+    uint32 Item_Shift;
+    uint8 *Destination = (uint8 *)a_Destination;
+    const volatile uint8 *Source = (const volatile uint8 *)a_Source;
+
+    Primask = NVIC_DisableExceptionsSave();
+    if(g_Udma_MemoryBusy == TRUE)
+    {
+        NVIC_RestoreExceptions(Primask);
+        return FALSE;
+    }
+    g_Udma_MemoryBusy = TRUE;
+    NVIC_RestoreExceptions(Primask);
+
+    /* Word items move 4 times faster, a fixed source is always a word */
+    if((((uint32)Destination | (uint32)Source | a_Length) & 0x3) == 0)
+    {
+        Item_Shift = 2;
+        Control = UDMA_CONTROL(UDMA_INC_32, (a_SourceFixed == TRUE) ? UDMA_INC_NONE : UDMA_INC_32, UDMA_SIZE_32, UDMA_ARB_32);
+    }
+    else
+    {
+        Item_Shift = 0;
+        Control = UDMA_CONTROL(UDMA_INC_8, (a_SourceFixed == TRUE) ? UDMA_INC_NONE : UDMA_INC_8, UDMA_SIZE_8, UDMA_ARB_32);
+    }
+
+    Items = a_Length >> Item_Shift;
+    while(Items != 0)
+    {
+        Chunk = (Items > UDMA_MAX_TRANSFER_ITEMS) ? UDMA_MAX_TRANSFER_ITEMS : Items;
+
+        /* Auto mode moves the whole chunk on one software request */
+        Udma_SetTransfer(UDMA_MEMORY_CHANNEL, UDMA_PRIMARY, UDMA_MODE_AUTO, Control, Source, Destination, Chunk);
+        Udma_EnableChannel(UDMA_MEMORY_CHANNEL);
+        Udma_RequestChannel(UDMA_MEMORY_CHANNEL);
+        while(Udma_IsChannelEnabled(UDMA_MEMORY_CHANNEL) == TRUE);
+        Udma_ClearInterrupt(UDMA_MEMORY_CHANNEL);
+
+        Destination += Chunk << Item_Shift;
+        if(a_SourceFixed == FALSE)
+        {
+            Source += Chunk << Item_Shift;
+        }
+        Items -= Chunk;
+    }
+
+    g_Udma_MemoryBusy = FALSE;
+
+    return TRUE;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/************************************************************************************
+ * Service Name: Udma_Init
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enable the uDMA controller and set the base of the control table, which is placed
+ *              at a 1024 bytes aligned address by the .udma_table section of tm4c123gh6pm.cmd.
+ *              Must be called before the drivers using the uDMA are initialized.
+ ************************************************************************************/
+void Udma_Init(void)
+{
+    /* Enable clock for the uDMA and wait for clock to start */
+    SYSCTL_RCGCDMA_REG |= UDMA_CLOCK_MASK;
+    while(!(SYSCTL_PRDMA_REG & UDMA_CLOCK_MASK));
+
+    UDMA_CFG_REG = UDMA_CFG_MASTEN_BIT_MASK;
+    UDMA_CTLBASE_REG = (uint32)g_Udma_ControlTable;
+
+    /* All the channels are free except the software channel */
+    UDMA_ENACLR_REG = 0xFFFFFFFF;
+    g_Udma_AllocatedChannels = 0;
+    g_Udma_MemoryBusy = FALSE;
+    Udma_AllocateChannel(UDMA_MEMORY_CHANNEL, 0);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_AllocateChannel
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number (0 to 31)
+ *                , a_Encoding - Peripheral assigned to the channel (channel map encoding 0 to 4)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE if the channel is already allocated
+ * Description: Function to allocate a channel to a peripheral, the channel is set to the default
+ *              priority, the primary structure, single and burst requests and the requests enabled.
+ ************************************************************************************/
+boolean Udma_AllocateChannel(uint8 a_Channel, uint8 a_Encoding)
+{
+    volatile uint32 *Channel_Map = &UDMA_CHMAP0_REG + (a_Channel / UDMA_CHMAP_CHANNELS);
+    uint32 Field_Shift = (a_Channel % UDMA_CHMAP_CHANNELS) * 4;
+    uint32 Primask;
+
+    Primask = NVIC_DisableExceptionsSave();
+
+    if(g_Udma_AllocatedChannels & UDMA_CHANNEL_MASK(a_Channel))
+    {
+        NVIC_RestoreExceptions(Primask);
+        return FALSE;
+    }
+    g_Udma_AllocatedChannels |= UDMA_CHANNEL_MASK(a_Channel);
+
+    *Channel_Map = (*Channel_Map & ~((uint32)UDMA_CHMAP_FIELD_MASK << Field_Shift)) | ((uint32)a_Encoding << Field_Shift);
+
+    NVIC_RestoreExceptions(Primask);
+
+    UDMA_PRIOCLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+    UDMA_ALTCLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+    UDMA_USEBURSTCLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+    UDMA_REQMASKCLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+
+    return TRUE;
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_FreeChannel
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to disable a channel and release it.
+ ************************************************************************************/
+void Udma_FreeChannel(uint8 a_Channel)
+{
+    uint32 Primask;
+
+    UDMA_ENACLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+    UDMA_REQMASKSET_REG = UDMA_CHANNEL_MASK(a_Channel);
+
+    Primask = NVIC_DisableExceptionsSave();
+    g_Udma_AllocatedChannels &= ~UDMA_CHANNEL_MASK(a_Channel);
+    NVIC_RestoreExceptions(Primask);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_SetTransfer
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ *                , a_Structure - Primary or alternate control structure (the alternate is for ping-pong)
+ *                , a_Mode - Transfer mode
+ *                , a_Control - Increments, item size and arbitration size built by UDMA_CONTROL
+ *                , a_Source - Start address of the source
+ *                , a_Destination - Start address of the destination
+ *                , a_Count - Number of items (1 to UDMA_MAX_TRANSFER_ITEMS)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to program a control structure of a channel, the channel is not enabled.
+ ************************************************************************************/
+void Udma_SetTransfer(uint8 a_Channel, Udma_StructureType a_Structure, Udma_ModeType a_Mode, uint32 a_Control,
+                      const volatile void *a_Source, volatile void *a_Destination, uint32 a_Count)
+{
+    Udma_FillStructure(&g_Udma_ControlTable[(a_Structure * UDMA_CHANNELS_COUNT) + a_Channel],
+                       a_Mode, a_Control, a_Source, a_Destination, a_Count);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_SetTask
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Mode - UDMA_MODE_MEM/PER_SCATTER_GATHER_ALT for all the tasks but the last one,
+ *                           UDMA_MODE_AUTO or UDMA_MODE_BASIC for the last one
+ *                , a_Control - Increments, item size and arbitration size built by UDMA_CONTROL
+ *                , a_Source - Start address of the source
+ *                , a_Destination - Start address of the destination
+ *                , a_Count - Number of items (1 to UDMA_MAX_TRANSFER_ITEMS)
+ * Parameters (inout): a_Task - Task of a scatter-gather list
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to fill a task of a scatter-gather list.
+ ************************************************************************************/
+void Udma_SetTask(Udma_ChannelControlType *a_Task, Udma_ModeType a_Mode, uint32 a_Control,
+                  const volatile void *a_Source, volatile void *a_Destination, uint32 a_Count)
+{
+    Udma_FillStructure(a_Task, a_Mode, a_Control, a_Source, a_Destination, a_Count);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_SetScatterGather
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ *                , a_Peripheral - TRUE for a peripheral scatter-gather (one task per request)
+ *                , a_Tasks - List of tasks, must stay valid until the transfer is done
+ *                , a_TasksCount - Number of tasks (1 to UDMA_MAX_TASKS)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to program the primary structure to copy each task to the alternate
+ *              structure and run it, the channel is not enabled.
+ ************************************************************************************/
+void Udma_SetScatterGather(uint8 a_Channel, boolean a_Peripheral, const Udma_ChannelControlType *a_Tasks,
+                           uint32 a_TasksCount)
+{
+    Udma_ChannelControlType *Primary = &g_Udma_ControlTable[a_Channel];
+
+    /* Each task (4 words) is copied in one arbitration of 4 words, which then runs the task */
+    Primary->SourceEnd = (uint32)&a_Tasks[a_TasksCount - 1].Spare;
+    Primary->DestinationEnd = (uint32)&g_Udma_ControlTable[UDMA_CHANNELS_COUNT + a_Channel].Spare;
+    Primary->Control = UDMA_CONTROL(UDMA_INC_32, UDMA_INC_32, UDMA_SIZE_32, UDMA_ARB_4) |
+                       (((a_TasksCount * 4) - 1) << UDMA_CHCTL_XFERSIZE_BITS_POS) |
+                       (uint32)((a_Peripheral == TRUE) ? UDMA_MODE_PER_SCATTER_GATHER : UDMA_MODE_MEM_SCATTER_GATHER);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_EnableChannel
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to enable a channel, the uDMA disables it at the end of the transfer.
+ ************************************************************************************/
+void Udma_EnableChannel(uint8 a_Channel)
+{
+    /* The control structure must be written before the channel can read it */
+    Data_Memory_Barrier();
+    UDMA_ENASET_REG = UDMA_CHANNEL_MASK(a_Channel);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_DisableChannel
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to stop a channel, the remaining items stay in its control structure.
+ ************************************************************************************/
+void Udma_DisableChannel(uint8 a_Channel)
+{
+    UDMA_ENACLR_REG = UDMA_CHANNEL_MASK(a_Channel);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_IsChannelEnabled
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - FALSE when the transfer is done
+ * Description: Function to check if a channel is still transferring.
+ ************************************************************************************/
+boolean Udma_IsChannelEnabled(uint8 a_Channel)
+{
+    return (UDMA_ENASET_REG & UDMA_CHANNEL_MASK(a_Channel)) ? TRUE : FALSE;
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_RequestChannel
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to start a transfer by a software request.
+ ************************************************************************************/
+void Udma_RequestChannel(uint8 a_Channel)
+{
+    UDMA_SWREQ_REG = UDMA_CHANNEL_MASK(a_Channel);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_GetMode
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ *                , a_Structure - Primary or alternate control structure
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Udma_ModeType - UDMA_MODE_STOP when the structure is done
+ * Description: Function to find the ping-pong structure to refill in the peripheral handler.
+ ************************************************************************************/
+Udma_ModeType Udma_GetMode(uint8 a_Channel, Udma_StructureType a_Structure)
+{
+    return (Udma_ModeType)(g_Udma_ControlTable[(a_Structure * UDMA_CHANNELS_COUNT) + a_Channel].Control & UDMA_CHCTL_XFERMODE_MASK);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_ClearInterrupt
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): a_Channel - Channel number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to clear the completion status of a channel, the completion interrupt
+ *              is raised on the interrupt of the peripheral assigned to the channel.
+ ************************************************************************************/
+void Udma_ClearInterrupt(uint8 a_Channel)
+{
+    UDMA_CHIS_REG = UDMA_CHANNEL_MASK(a_Channel);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_Copy
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Source - Start address of the source
+ *                , a_Length - Number of bytes
+ * Parameters (inout): None
+ * Parameters (out): a_Destination - Start address of the destination
+ * Return value: boolean - FALSE if the memory channel is in use
+ * Description: memcpy replacement on the software channel in auto mode, with 32-bit items when
+ *              both addresses and the length are aligned to 4. Waits until the copy is done,
+ *              the interrupts are served meanwhile.
+ ************************************************************************************/
+boolean Udma_Copy(void *a_Destination, const void *a_Source, uint32 a_Length)
+{
+    return Udma_MemoryTransfer(a_Destination, a_Source, FALSE, a_Length);
+}
+
+
+/************************************************************************************
+ * Service Name: Udma_Fill
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): a_Value - Byte written
+ *                , a_Length - Number of bytes
+ * Parameters (inout): None
+ * Parameters (out): a_Destination - Start address of the destination
+ * Return value: boolean - FALSE if the memory channel is in use
+ * Description: memset replacement on the software channel in auto mode, with 32-bit items when the
+ *              address and the length are aligned to 4. Waits until the fill is done.
+ ************************************************************************************/
+boolean Udma_Fill(void *a_Destination, uint8 a_Value, uint32 a_Length)
+{
+    /* Written before the channel is taken, the value is only read by the running fill */
+    if(g_Udma_MemoryBusy == TRUE)
+    {
+        return FALSE;
+    }
+    g_Udma_FillValue = (uint32)a_Value * 0x01010101;
+
+    return Udma_MemoryTransfer(a_Destination, &g_Udma_FillValue, TRUE, a_Length);
+}
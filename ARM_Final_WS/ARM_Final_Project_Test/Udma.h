@@ -0,0 +1,318 @@
+/**********************************************************************************************************
+ * [FILE NAME]      :           Udma.h                                                                    *
+ * [DESCRIPTION]    :           Header file for the micro direct memory access (uDMA) driver              *
+ * [DATE CREATED]   :           OCT 16, 2026                                                              *
+ * [AURTHOR]        :           Alaa Mekawi                                                               *
+ *********************************************************************************************************/
+#ifndef UDMA_H_
+#define UDMA_H_
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+#define UDMA_CHANNELS_COUNT           32
+#define UDMA_CLOCK_MASK               0x01
+#define UDMA_CFG_MASTEN_BIT_MASK      0x00000001
+
+/* Items moved by one control structure, and tasks of one scatter-gather list */
+#define UDMA_MAX_TRANSFER_ITEMS       1024
+#define UDMA_MAX_TASKS                256
+
+/* Channel 30 is the dedicated software channel, reserved for Udma_Copy and Udma_Fill */
+#define UDMA_MEMORY_CHANNEL           30
+
+/* Channel control word fields */
+#define UDMA_CHCTL_DSTINC_BITS_POS    30
+#define UDMA_CHCTL_DSTSIZE_BITS_POS   28
+#define UDMA_CHCTL_SRCINC_BITS_POS    26
+#define UDMA_CHCTL_SRCSIZE_BITS_POS   24
+#define UDMA_CHCTL_ARBSIZE_BITS_POS   14
+#define UDMA_CHCTL_XFERSIZE_BITS_POS  4
+#define UDMA_CHCTL_XFERSIZE_MASK      0x00003FF0
+#define UDMA_CHCTL_XFERMODE_MASK      0x00000007
+
+/* Increment, item size and arbitration size of a channel control word (without the count and the mode) */
+#define UDMA_CONTROL(DST_INC, SRC_INC, SIZE, ARB)  \
+    (((uint32)(DST_INC) << UDMA_CHCTL_DSTINC_BITS_POS) | ((uint32)(SIZE) << UDMA_CHCTL_DSTSIZE_BITS_POS) | \
+     ((uint32)(SRC_INC) << UDMA_CHCTL_SRCINC_BITS_POS) | ((uint32)(SIZE) << UDMA_CHCTL_SRCSIZE_BITS_POS) | \
+     ((uint32)(ARB) << UDMA_CHCTL_ARBSIZE_BITS_POS))
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+typedef enum
+{
+    UDMA_SIZE_8,
+    UDMA_SIZE_16,
+    UDMA_SIZE_32
+}Udma_ItemSizeType;
+
+/* Address increment after each item, or a fixed address (peripheral data register) */
+typedef enum
+{
+    UDMA_INC_8,
+    UDMA_INC_16,
+    UDMA_INC_32,
+    UDMA_INC_NONE
+}Udma_IncrementType;
+
+/* Items moved before the bus is re-arbitrated */
+typedef enum
+{
+    UDMA_ARB_1,
+    UDMA_ARB_2,
+    UDMA_ARB_4,
+    UDMA_ARB_8,
+    UDMA_ARB_16,
+    UDMA_ARB_32,
+    UDMA_ARB_64,
+    UDMA_ARB_128,
+    UDMA_ARB_256,
+    UDMA_ARB_512,
+    UDMA_ARB_1024
+}Udma_ArbitrationType;
+
+typedef enum
+{
+    UDMA_MODE_STOP,                 /* Set by the uDMA at the end of the transfer */
+    UDMA_MODE_BASIC,                /* One arbitration size per request, for the peripherals */
+    UDMA_MODE_AUTO,                 /* The whole transfer on one request, for the memory transfers */
+    UDMA_MODE_PINGPONG,             /* Alternates between the primary and the alternate structures */
+    UDMA_MODE_MEM_SCATTER_GATHER,
+    UDMA_MODE_MEM_SCATTER_GATHER_ALT,
+    UDMA_MODE_PER_SCATTER_GATHER,
+    UDMA_MODE_PER_SCATTER_GATHER_ALT
+}Udma_ModeType;
+
+typedef enum
+{
+    UDMA_PRIMARY,
+    UDMA_ALTERNATE
+}Udma_StructureType;
+
+/* Channel control structure, also a task of a scatter-gather list */
+typedef struct
+{
+    volatile uint32 SourceEnd;
+    volatile uint32 DestinationEnd;
+    volatile uint32 Control;
+    volatile uint32 Spare;
+}Udma_ChannelControlType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/************************************************************************************
+* Service Name: Udma_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enable the uDMA controller and set the base of the control table, which is placed
+*              at a 1024 bytes aligned address by the .udma_table section of tm4c123gh6pm.cmd.
+*              Must be called before the drivers using the uDMA are initialized.
+************************************************************************************/
+void Udma_Init(void);
+
+
+/************************************************************************************
+* Service Name: Udma_AllocateChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number (0 to 31)
+*                , a_Encoding - Peripheral assigned to the channel (channel map encoding 0 to 4)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the channel is already allocated
+* Description: Function to allocate a channel to a peripheral, the channel is set to the default
+*              priority, the primary structure, single and burst requests and the requests enabled.
+************************************************************************************/
+boolean Udma_AllocateChannel(uint8 a_Channel, uint8 a_Encoding);
+
+
+/************************************************************************************
+* Service Name: Udma_FreeChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a channel and release it.
+************************************************************************************/
+void Udma_FreeChannel(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_SetTransfer
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+*                , a_Structure - Primary or alternate control structure (the alternate is for ping-pong)
+*                , a_Mode - Transfer mode
+*                , a_Control - Increments, item size and arbitration size built by UDMA_CONTROL
+*                , a_Source - Start address of the source
+*                , a_Destination - Start address of the destination
+*                , a_Count - Number of items (1 to UDMA_MAX_TRANSFER_ITEMS)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to program a control structure of a channel, the channel is not enabled.
+************************************************************************************/
+void Udma_SetTransfer(uint8 a_Channel, Udma_StructureType a_Structure, Udma_ModeType a_Mode, uint32 a_Control,
+                      const volatile void *a_Source, volatile void *a_Destination, uint32 a_Count);
+
+
+/************************************************************************************
+* Service Name: Udma_SetTask
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Mode - UDMA_MODE_MEM/PER_SCATTER_GATHER_ALT for all the tasks but the last one,
+*                           UDMA_MODE_AUTO or UDMA_MODE_BASIC for the last one
+*                , a_Control - Increments, item size and arbitration size built by UDMA_CONTROL
+*                , a_Source - Start address of the source
+*                , a_Destination - Start address of the destination
+*                , a_Count - Number of items (1 to UDMA_MAX_TRANSFER_ITEMS)
+* Parameters (inout): a_Task - Task of a scatter-gather list
+* Parameters (out): None
+* Return value: None
+* Description: Function to fill a task of a scatter-gather list.
+************************************************************************************/
+void Udma_SetTask(Udma_ChannelControlType *a_Task, Udma_ModeType a_Mode, uint32 a_Control,
+                  const volatile void *a_Source, volatile void *a_Destination, uint32 a_Count);
+
+
+/************************************************************************************
+* Service Name: Udma_SetScatterGather
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+*                , a_Peripheral - TRUE for a peripheral scatter-gather (one task per request)
+*                , a_Tasks - List of tasks, must stay valid until the transfer is done
+*                , a_TasksCount - Number of tasks (1 to UDMA_MAX_TASKS)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to program the primary structure to copy each task to the alternate
+*              structure and run it, the channel is not enabled.
+************************************************************************************/
+void Udma_SetScatterGather(uint8 a_Channel, boolean a_Peripheral, const Udma_ChannelControlType *a_Tasks,
+                           uint32 a_TasksCount);
+
+
+/************************************************************************************
+* Service Name: Udma_EnableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable a channel, the uDMA disables it at the end of the transfer.
+************************************************************************************/
+void Udma_EnableChannel(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_DisableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a channel, the remaining items stay in its control structure.
+************************************************************************************/
+void Udma_DisableChannel(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_IsChannelEnabled
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE when the transfer is done
+* Description: Function to check if a channel is still transferring.
+************************************************************************************/
+boolean Udma_IsChannelEnabled(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_RequestChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a transfer by a software request.
+************************************************************************************/
+void Udma_RequestChannel(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_GetMode
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+*                , a_Structure - Primary or alternate control structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Udma_ModeType - UDMA_MODE_STOP when the structure is done
+* Description: Function to find the ping-pong structure to refill in the peripheral handler.
+************************************************************************************/
+Udma_ModeType Udma_GetMode(uint8 a_Channel, Udma_StructureType a_Structure);
+
+
+/************************************************************************************
+* Service Name: Udma_ClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_Channel - Channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the completion status of a channel, the completion interrupt
+*              is raised on the interrupt of the peripheral assigned to the channel.
+************************************************************************************/
+void Udma_ClearInterrupt(uint8 a_Channel);
+
+
+/************************************************************************************
+* Service Name: Udma_Copy
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Source - Start address of the source
+*                , a_Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): a_Destination - Start address of the destination
+* Return value: boolean - FALSE if the memory channel is in use
+* Description: memcpy replacement on the software channel in auto mode, with 32-bit items when
+*              both addresses and the length are aligned to 4. Waits until the copy is done,
+*              the interrupts are served meanwhile.
+************************************************************************************/
+boolean Udma_Copy(void *a_Destination, const void *a_Source, uint32 a_Length);
+
+
+/************************************************************************************
+* Service Name: Udma_Fill
+* Sync/Async: Synchronous
+* Reentrancy: Non-reentrant
+* Parameters (in): a_Value - Byte written
+*                , a_Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): a_Destination - Start address of the destination
+* Return value: boolean - FALSE if the memory channel is in use
+* Description: memset replacement on the software channel in auto mode, with 32-bit items when the
+*              address and the length are aligned to 4. Waits until the fill is done.
+************************************************************************************/
+boolean Udma_Fill(void *a_Destination, uint8 a_Value, uint32 a_Length);
+
+#endif /* UDMA_H_ */
@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: Common - Macros
+ *
+ * File Name: common_macros.h
+ *
+ * Description: Commonly used Macros
+ *
+ * Author: Alaa Mekawi
+ *
+ *******************************************************************************/
+
+#ifndef COMMON_MACROS_H_
+#define COMMON_MACROS_H_
+
+/* Count the leading zeros of a 32-bit value using the CLZ instruction (returns 32 for 0) */
+#ifdef HOST_SIMULATION
+#define COUNT_LEADING_ZEROS(VALUE)     (((uint32)(VALUE) == 0) ? 32 : (uint32)__builtin_clz((uint32)(VALUE)))
+#else
+#define COUNT_LEADING_ZEROS(VALUE)     ((uint32)_norm((uint32)(VALUE)))
+#endif
+
+/* Count the trailing zeros of a non-zero 32-bit value ... isolate the lowest set bit then use CLZ */
+#define COUNT_TRAILING_ZEROS(VALUE)    (31 - COUNT_LEADING_ZEROS((uint32)(VALUE) & (0 - (uint32)(VALUE))))
+
+#endif /* COMMON_MACROS_H_ */
@@ -1,107 +1,320 @@
 #include "SysTick.h"
 #include "NVIC.h"
+#include "Power.h"
+#include "SwTimer.h"
+#include "EventRing.h"
+#include "Os.h"
+#include "Deferred.h"
+#include "Delay.h"
+#include "Clock.h"
+#include "IsrStats.h"
+#include "Udma.h"
+#include "Uart0.h"
+#include "Log.h"
+#include "Fault.h"
+#include "MPU.h"
+#include "Stack.h"
+#include "Gpio.h"
+#include "GpioBench.h"
+#include "Button.h"
+#include "IrqGov.h"
 #include "tm4c123gh6pm_registers.h"
 
 #define GPIO_PORTF_IRQ_NUM                30
 #define GPIO_PORTF_INTERRUPT_PRIORITY     2
-#define SYSTICK_INTERRUPT_PRIORITY        1
 
-#define NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND 364
+/* System clock generated by the PLL from the 16 MHz crystal */
+#define SYSTEM_CLOCK_FREQUENCY            80000000
 
-/* Global variable to count time in seconds */
-volatile uint8 g_Counter = 0;
+/* SysTick tick period and the LEDs sequence period in ticks */
+#define SYSTICK_TICK_TIME_MS              10
+#define LEDS_PERIOD_TICKS                 100
+#define LEDS_HOLD_TICKS                   500
 
-void Delay_MS(unsigned long long n)
+#define LEDS_SEQUENCE_LENGTH              3
+
+#define GPIO_PORTF_CLOCK_MASK             0x20
+
+/* SW2 on PF0, SW1 on PF4, Red, Blue and Green LEDs on PF1, PF2 and PF3 */
+#define SW2_PIN                           GPIO_PIN_0
+#define SW1_PIN                           GPIO_PIN_4
+#define LEDS_PINS                         (GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+/* Serial console on the virtual COM port */
+#define UART0_BAUD_RATE                   115200
+
+/* Argument of the buttons bottom half, the button above the event */
+#define APP_WORK_BUTTON_BITS_POS          8
+#define APP_WORK_EVENT_MASK               0xFF
+
+/* Size of the SW2 events to LEDs task ring */
+#define APP_EVENTS_RING_CAPACITY          8
+
+/* LEDs task priority and stack size in words */
+#define LEDS_TASK_PRIORITY                2
+#define LEDS_TASK_STACK_WORDS             256
+
+/* Pins of the board, the buttons and the LEDs */
+#define APP_PINS_COUNT                    2
+#define APP_BUTTONS_COUNT                 2
+
+/* Interrupts governed, and the PORTF edge interrupts admitted per 100 ms window ... a press interrupts
+ * once then the buttons are sampled for at least 300 ms, more edges are a noisy line */
+#define APP_IRQ_SOURCES_COUNT             1
+#define GPIO_PORTF_IRQ_BUDGET             4
+
+/* Application MPU regions, the stack guards are added by the kernel and the MPU driver */
+#define APP_MPU_REGIONS_COUNT             1
+
+typedef enum
 {
-    volatile uint64 count = 0;
-    while(count++ < (NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND * n) );
-}
+    APP_EVENT_SW2_PRESSED       /* Published from App_ButtonWork */
+}App_EventIdType;
+
+/* Index of the buttons in g_AppButtons */
+typedef enum
+{
+    APP_BUTTON_SW1,
+    APP_BUTTON_SW2
+}App_ButtonType;
+
+typedef struct
+{
+    uint32          Tick;       /* SysTick tick count when the event was published */
+    App_EventIdType Id;
+}App_EventType;
+
+/* Red, Blue then Green LED */
+static const uint8 g_LedsSequence[LEDS_SEQUENCE_LENGTH] = {0x02, 0x04, 0x08};
+
+/* The buttons bottom half (PendSV) is the producer and the LEDs task is the consumer */
+static App_EventType  g_SW2EventsBuffer[APP_EVENTS_RING_CAPACITY];
+static EventRing_Type g_SW2Events;
+
+static Os_TaskType g_LedsTask;
+#pragma DATA_ALIGN(g_LedsTaskStack, MPU_GUARD_SIZE)
+static uint32 g_LedsTaskStack[LEDS_TASK_STACK_WORDS];
 
-/* GPIO PORTF External Interrupt - ISR */
+/* The buttons pull their pin down, their edges are configured by Button_Init. The LEDs start off.
+ * PF0 is unlocked by the driver */
+static const Gpio_PinConfigType g_AppPins[APP_PINS_COUNT] =
+{
+    GPIO_PIN_INPUT(GPIO_PORT_F, SW1_PIN | SW2_PIN, GPIO_PULL_UP, GPIO_EDGE_NONE),
+    GPIO_PIN_OUTPUT(GPIO_PORT_F, LEDS_PINS, 0)
+};
+
+static const Button_ConfigType g_AppButtons[APP_BUTTONS_COUNT] =
+{
+    {GPIO_PORT_F, SW1_PIN, TRUE},
+    {GPIO_PORT_F, SW2_PIN, TRUE}
+};
+
+/* PORTF is disabled in the NVIC while shed, IM is owned by the buttons. Polling a press edge starts the
+ * buttons sampling, which masks the edges as the handler does */
+static const IrqGov_ConfigType g_AppIrqSources[APP_IRQ_SOURCES_COUNT] =
+{
+    {GPIO_PORTF_IRQ_NUM, GPIO_PORTF_IRQ_BUDGET, GPIO_PORT_F, 0, Button_EdgeHandler}
+};
+
+/* No access to the first 32 bytes of the memory map, a NULL pointer dereference raises a MemManage fault.
+ * The flash vector table there is only read by the reset and by NVIC_InitVectorTable */
+static const MPU_RegionType g_AppMpuRegions[APP_MPU_REGIONS_COUNT] =
+{
+    MPU_REGION(0, 0x00000000, 5, MPU_ATTR_AP_NO_ACCESS | MPU_ATTR_XN | MPU_ATTR_FLASH)
+};
+
+/* GPIO PORTF External Interrupt - ISR, the first edge of a press wakes up the buttons sampling. A storm
+ * of edges is shed by the governor */
 void GPIOPortF_Handler(void)
 {
-    SysTick_Stop();
-    GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x0E; /* Turn on the Red, Blue and Green LEDs */
-    Delay_MS(5000);
-    SysTick_Start();
-    GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
+    ISR_STATS_ENTER();
+
+    if(IrqGov_Admit() == TRUE)
+    {
+        Button_EdgeHandler();
+    }
+
+    ISR_STATS_EXIT();
 }
 
-/* Enable PF0 (SW2) and activate external interrupt with falling edge */
-void SW2_Init(void)
+/* Bottom half of the buttons events, run by PendSV once the handlers are finished. The button and
+ * the event are packed in the argument by App_ButtonEvent */
+static void App_ButtonWork(void *a_Argument)
 {
-    GPIO_PORTF_LOCK_REG   = 0x4C4F434B;   /* Unlock the GPIO_PORTF_CR_REG */
-    GPIO_PORTF_CR_REG    |= (1<<0);       /* Enable changes on PF0 */
-    GPIO_PORTF_AMSEL_REG &= ~(1<<0);      /* Disable Analog on PF0 */
-    GPIO_PORTF_PCTL_REG  &= 0xFFFFFFF0;   /* Clear PMCx bits for PF0 to use it as GPIO pin */
-    GPIO_PORTF_DIR_REG   &= ~(1<<0);      /* Configure PF0 as input pin */
-    GPIO_PORTF_AFSEL_REG &= ~(1<<0);      /* Disable alternative function on PF0 */
-    GPIO_PORTF_PUR_REG   |= (1<<0);       /* Enable pull-up on PF0 */
-    GPIO_PORTF_DEN_REG   |= (1<<0);       /* Enable Digital I/O on PF0 */
-    GPIO_PORTF_IS_REG    &= ~(1<<0);      /* PF0 detect edges */
-    GPIO_PORTF_IBE_REG   &= ~(1<<0);      /* PF0 will detect a certain edge */
-    GPIO_PORTF_IEV_REG   &= ~(1<<0);      /* PF0 will detect a falling edge */
-    GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
-    GPIO_PORTF_IM_REG    |= (1<<0);       /* Enable Interrupt on PF0 pin */
+    uint8 Button = (uint8)((uint32)a_Argument >> APP_WORK_BUTTON_BITS_POS);
+    Button_EventType Button_Event = (Button_EventType)((uint32)a_Argument & APP_WORK_EVENT_MASK);
+    App_EventType Event;
 
-    /* Enable NVIC GPIO PORTF IRQ and set its priority */
-    NVIC_EnableIRQ(GPIO_PORTF_IRQ_NUM);
-    NVIC_SetPriorityIRQ(GPIO_PORTF_IRQ_NUM,GPIO_PORTF_INTERRUPT_PRIORITY);
+    LOG2("Button %u event %u", Button, Button_Event);
+
+    if((Button == APP_BUTTON_SW2) && (Button_Event == BUTTON_EVENT_PRESS))
+    {
+        /* The 5 seconds hold is handled by the LEDs task */
+        Event.Tick = SysTick_GetTickCount();
+        Event.Id = APP_EVENT_SW2_PRESSED;
+        EventRing_Push(&g_SW2Events, &Event);
+        LOG1("SW2 pressed at tick %u", Event.Tick);
+        Os_TaskNotify(&g_LedsTask);
+    }
 }
 
-/* Enable PF1, PF2 and PF3 (RED, Blue and Green LEDs) */
-void Leds_Init(void)
+/* Debounced buttons events, called from the SysTick handler ... only queued, the handler keeps
+ * advancing the wheel */
+void App_ButtonEvent(uint8 a_Button, Button_EventType a_Event)
 {
-    GPIO_PORTF_AMSEL_REG &= 0xF1;         /* Disable Analog on PF1, PF2 and PF3 */
-    GPIO_PORTF_PCTL_REG  &= 0xFFFF000F;   /* Clear PMCx bits for PF1, PF2 and PF3 to use it as GPIO pin */
-    GPIO_PORTF_DIR_REG   |= 0x0E;         /* Configure PF1, PF2 and PF3 as output pin */
-    GPIO_PORTF_AFSEL_REG &= 0xF1;         /* Disable alternative function on PF1, PF2 and PF3 */
-    GPIO_PORTF_DEN_REG   |= 0x0E;         /* Enable Digital I/O on PF1, PF2 and PF3 */
-    GPIO_PORTF_DATA_REG  &= 0xF1;         /* Clear bit 0, 1 and 2 in Data register to turn off the leds */
+    (void)Deferred_Post(App_ButtonWork, (void *)(((uint32)a_Button << APP_WORK_BUTTON_BITS_POS) | (uint32)a_Event));
 }
 
-void SysTick_CallBackFunc(void)
+/* Debounce SW1 (PF4) and SW2 (PF0) and enable their external interrupt, the pins are configured by g_AppPins */
+void Buttons_Init(void)
 {
-    g_Counter++;
+    Button_Init(g_AppButtons, APP_BUTTONS_COUNT, App_ButtonEvent);
 
-    switch(g_Counter)
+    /* Enable NVIC GPIO PORTF IRQ and set its priority */
+    NVIC_EnableIRQ(GPIO_PORTF_IRQ_NUM);
+    NVIC_SetPriorityIRQ(GPIO_PORTF_IRQ_NUM,GPIO_PORTF_INTERRUPT_PRIORITY);
+}
+
+/* LEDs task - moves the LEDs sequence every 1 second and turns on all the LEDs for 5 seconds when SW2 is pressed,
+ * the interrupts timing is reported on UART0 at each press */
+void Leds_Task(void *a_Argument)
+{
+    App_EventType Event;
+    uint8 Counter = 0;
+    boolean Pressed;
+    uint32 Hold_End = 0;
+    uint32 Remaining;
+
+    while(1)
     {
-    case 1:
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x02; /* Turn on the Red LED and disable the others */
-        break;
-    case 2:
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x04; /* Turn on the Blue LED and disable the others */
-        break;
-    case 3:
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x08; /* Turn on the Green LED and disable the others */
-        g_Counter = 0;
-        break;
+        /* Block until the next step or until the SW2 press notifies the task */
+        if(Os_TaskWait(LEDS_PERIOD_TICKS) == TRUE)
+        {
+            /* The hold is timed from the tick of the press, a press queued while the LEDs were held
+             * extends the hold from its own tick instead of restarting it */
+            Pressed = FALSE;
+            while(EventRing_Pop(&g_SW2Events, &Event) == TRUE)
+            {
+                switch(Event.Id)
+                {
+                case APP_EVENT_SW2_PRESSED:
+                    Hold_End = Event.Tick + LEDS_HOLD_TICKS;
+                    Pressed = TRUE;
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            if(Pressed == FALSE)
+            {
+                continue;
+            }
+
+            /* Report the interrupts timing and load and the stacks usage on the serial console */
+            IsrStats_Dump(Uart0_SendString);
+            IrqGov_Dump(Uart0_SendString);
+            Stack_Dump(Uart0_SendString);
+
+            Gpio_SetPins(GPIO_PORT_F, LEDS_PINS);       /* Turn on the Red, Blue and Green LEDs */
+
+            Remaining = Hold_End - SysTick_GetTickCount();
+            if((Remaining != 0) && (Remaining <= LEDS_HOLD_TICKS))
+            {
+                Os_Delay(Remaining);
+            }
+            LOG2("SW2 hold from tick %u to %u", Hold_End - LEDS_HOLD_TICKS, SysTick_GetTickCount());
+        }
+        else
+        {
+            /* Turn on the next LED of the sequence and disable the others */
+            Gpio_WritePins(GPIO_PORT_F, LEDS_PINS, g_LedsSequence[Counter]);
+
+            Counter++;
+            if(Counter == LEDS_SEQUENCE_LENGTH)
+            {
+                Counter = 0;
+            }
+        }
     }
 }
 
 int main(void)
 {
-    /* Enable clock for PORTF and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x20;
-    while(!(SYSCTL_PRGPIO_REG & 0x20));
+    /* Paint the free main stack for its high-water mark, before anything runs on it */
+    Stack_Init();
 
-    /* Initialize the SW2(PF0) as GPIO Pin and activate external interrupt with falling edge */
-    SW2_Init();
+    /* Create the ISR to task events ring before any interrupt is enabled */
+    EventRing_Init(&g_SW2Events, g_SW2EventsBuffer, sizeof(App_EventType), APP_EVENTS_RING_CAPACITY);
 
-    /* Initialize the LEDs as GPIO Pins */
-    Leds_Init();
+    /* Handlers are registered at run time in the SRAM copy of the vector table */
+    NVIC_InitVectorTable();
 
-    /* Start SysTick Timer to generate interrupt every 1 second */
-    SysTick_Init(1000);
-    NVIC_SetPriorityException(EXCEPTION_SYSTICK_TYPE,SYSTICK_INTERRUPT_PRIORITY);
-    SysTick_SetCallBack(SysTick_CallBackFunc);
+    /* Capture the faults in the record kept over the reset, then reboot */
+    Fault_Init();
 
-    /* Enable Interrupts, Exceptions and Faults */
-    Enable_Exceptions();
-    Enable_Faults();
+    /* Run at 80 MHz before any timing is calculated */
+    Clock_Init(CLOCK_SOURCE_MOSC, SYSTEM_CLOCK_FREQUENCY);
 
-    while(1)
-    {
+    /* Start the cycle counter used for the short delays and the time measurements */
+    Delay_Init();
 
-    }
+    /* Measure the latency, execution time and jitter of the instrumented handlers */
+    IsrStats_Init();
+
+    /* Bulk data movement, the channels are allocated by the drivers */
+    Udma_Init();
+
+    /* Serial console, the bytes are sent by uDMA */
+    Uart0_Init(UART0_BAUD_RATE, UART0_FIFO_LEVEL_8_16, UART0_FIFO_LEVEL_8_16);
+
+    /* Tokenized log records, drained to UART0 by the idle task */
+    Log_Init();
+
+    /* Report the fault that rebooted the device, if any */
+    Fault_Report();
+
+#if (GPIO_BENCH_ENABLE == 1)
+    /* Toggle rate and ISR to pin latency of PORTF on both buses, on the Red LED before it is configured */
+    GpioBench_Report(GPIO_PORT_F, GPIO_PIN_1, Uart0_SendString);
+#endif
+
+    /* Enable clock for PORTF on the AHB, the fastest pin toggling, and wait for clock to start */
+    Gpio_EnablePort(GPIO_PORT_F, GPIO_BUS_AHB);
+
+    /* Configure the buttons (PF0, PF4) and the LEDs (PF1 .. PF3) from the pins table */
+    Gpio_ConfigurePins(g_AppPins, APP_PINS_COUNT);
+
+    /* Start SysTick Timer to generate a tick every 10 milli-seconds, the LEDs sequence moves every 1 second */
+    SysTick_Init(SYSTICK_TICK_TIME_MS);
+
+    /* The timer wheel is advanced by the SysTick handler, called directly from the SRAM vector table */
+    SwTimer_Init();
+    NVIC_RegisterHandler(NVIC_SYSTICK_VECTOR, SwTimer_SysTickHandler);
+
+    /* Count the activations of the interrupts before they are enabled, a shed one is polled by the wheel */
+    IrqGov_Init(g_AppIrqSources, APP_IRQ_SOURCES_COUNT);
+
+    /* The buttons are sampled by a timer of the wheel while one of them is active */
+    Buttons_Init();
+
+    /* The kernel places PendSV and SysTick priorities and creates the idle task */
+    Os_Init();
+    Os_CreateTask(&g_LedsTask, Leds_Task, NULL_PTR, g_LedsTaskStack, LEDS_TASK_STACK_WORDS, LEDS_TASK_PRIORITY);
+
+    /* Guard the main stack and the task stacks in hardware, the overflows are captured by Fault_Handler */
+    MPU_Init(g_AppMpuRegions, APP_MPU_REGIONS_COUNT);
+
+    /* The idle task sends the log records before sleeping */
+    Os_SetIdleHook(Log_Flush);
+
+    /* Enter Deep-Sleep when idle, keep PORTF clocked so the buttons can wake up the processor */
+    Power_Init(POWER_DEEP_SLEEP_MODE, GPIO_PORTF_CLOCK_MASK);
+
+    /* Enable Faults, the interrupts are enabled by the kernel */
+    Enable_Faults();
+
+    /* Run the tasks, never returns */
+    Os_Start();
 }
@@ -12,6 +12,9 @@ MEMORY
 {
     FLASH (RX) : origin = 0x00000000, length = 0x00040000
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
+
+    /* Log format strings, kept in the .out file for the host decoder but not loaded on the target */
+    LOGSTR (R) : origin = 0x60000000, length = 0x00010000
 }
 
 /* The following command line options are set as part of the CCS project.    */
@@ -36,10 +39,18 @@ SECTIONS
     .init_array : > FLASH
 
     .vtable :   > 0x20000000
+    /* uDMA channel control table, the controller requires a 1024 bytes aligned base */
+    .udma_table : > SRAM, align(1024)
+    /* Not initialized by the C start-up, the fault record survives a system reset */
+    .noinit : > SRAM, type = NOINIT
+
+    .log_strings : > LOGSTR, type = COPY
     .data   :   > SRAM
     .bss    :   > SRAM
     .sysmem :   > SRAM
-    .stack  :   > SRAM
+    /* The MPU guard region on the lowest 32 bytes of the main stack requires a 32 bytes aligned base */
+    .stack  :   > SRAM, align(32)
 }
 
+/* STACK_MAIN_BYTES in Stack.h */
 __STACK_TOP = __stack + 512;
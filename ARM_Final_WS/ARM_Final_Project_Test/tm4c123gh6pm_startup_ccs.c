@@ -31,13 +31,12 @@
 //*****************************************************************************
 void ResetISR(void);
 static void NmiSR(void);
-static void FaultISR(void);
 static void IntDefaultHandler(void);
-static void Bus_FaultISR(void);
-static void Usage_FaultISR(void);
-static void Mem_FaultISR(void);
 extern void GPIOPortF_Handler(void);
 extern void SysTick_Handler(void);
+extern void PendSV_Handler(void);
+extern void UART0_Handler(void);
+extern void Fault_Handler(void);
 //*****************************************************************************
 //
 // External declaration for the reset handler that is to be called when the
@@ -66,6 +65,11 @@ extern uint32_t __STACK_TOP;
 // ensure that it ends up at physical address 0x0000.0000 or at the start of
 // the program if located at a start address other than 0.
 //
+// Handlers added here are measured by IsrStats when they call ISR_STATS_ENTER()
+// first and ISR_STATS_EXIT() last (see IsrStats.h).
+// The faults are captured by Fault_Handler, which reboots the device and the
+// next boot reports them (see Fault.h).
+//
 //*****************************************************************************
 #pragma DATA_SECTION(g_pfnVectors, ".intvecs")
 void (* const g_pfnVectors[])(void) =
@@ -74,10 +78,10 @@ void (* const g_pfnVectors[])(void) =
  // The initial stack pointer
  ResetISR,                               // The reset handler
  NmiSR,                                  // The NMI handler
- FaultISR,                               // The hard fault handler
- Mem_FaultISR,                           // The MPU fault handler
- Bus_FaultISR,                           // The bus fault handler
- Usage_FaultISR,                         // The usage fault handler
+ Fault_Handler,                          // The hard fault handler
+ Fault_Handler,                          // The MPU fault handler
+ Fault_Handler,                          // The bus fault handler
+ Fault_Handler,                          // The usage fault handler
  0,                                      // Reserved
  0,                                      // Reserved
  0,                                      // Reserved
@@ -85,14 +89,14 @@ void (* const g_pfnVectors[])(void) =
  IntDefaultHandler,                      // SVCall handler
  IntDefaultHandler,                      // Debug monitor handler
  0,                                      // Reserved
- IntDefaultHandler,                      // The PendSV handler
+ PendSV_Handler,                         // The PendSV handler
  SysTick_Handler,                      // The SysTick handler
  IntDefaultHandler,                      // GPIO Port A
  IntDefaultHandler,                      // GPIO Port B
  IntDefaultHandler,                      // GPIO Port C
  IntDefaultHandler,                      // GPIO Port D
  IntDefaultHandler,                      // GPIO Port E
- IntDefaultHandler,                      // UART0 Rx and Tx
+ UART0_Handler,                          // UART0 Rx and Tx
  IntDefaultHandler,                      // UART1 Rx and Tx
  IntDefaultHandler,                      // SSI0 Rx and Tx
  IntDefaultHandler,                      // I2C0 Master and Slave
@@ -266,53 +270,6 @@ NmiSR(void)
     {
     }
 }
-static void
-Bus_FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
-static void
-Usage_FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
-static void
-Mem_FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
-//*****************************************************************************
-//
-// This is the code that gets called when the processor receives a fault
-// interrupt.  This simply enters an infinite loop, preserving the system state
-// for examination by a debugger.
-//
-//*****************************************************************************
-static void
-FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
 
 //*****************************************************************************
 //
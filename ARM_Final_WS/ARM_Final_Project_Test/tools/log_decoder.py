@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+[FILE NAME]      :   log_decoder.py
+[DESCRIPTION]    :   Host decoder of the tokenized log records sent by Log.c on UART0
+[DATE CREATED]   :   OCT 16, 2026
+[AURTHOR]        :   Alaa Mekawi
+
+The firmware only sends a format ID, a DWT timestamp and raw arguments. The format strings
+live in the .log_strings section of the .out file (not loaded on the target), so the string
+table is extracted at build time and used to format the records on the host.
+
+    Post-build step (CCS Build > Steps):
+        python tools/log_decoder.py extract ${ProjName}.out ${ProjName}.logstr.json
+
+    Decoding a capture of UART0 (115200 8N1), e.g. from the LaunchPad virtual COM port:
+        python tools/log_decoder.py decode ARM_Final_Project_Test.logstr.json capture.bin
+        stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 | python tools/log_decoder.py decode table.json -
+
+Bytes that are not log records (e.g. the IsrStats report) are printed as text.
+"""
+import argparse
+import json
+import re
+import struct
+import sys
+
+LOG_STRINGS_SECTION = ".log_strings"
+LOG_STRINGS_BASE = 0x60000000
+LOG_HEADER_SYNC = 0xA5
+LOG_MAX_ARGUMENTS = 4
+LOG_RECORD_SIZE = 4 * (3 + LOG_MAX_ARGUMENTS)
+DEFAULT_CLOCK = 80000000
+
+FORMAT_SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|t|j)?([diuxXcop%s])")
+
+
+def read_section(elf_path, section_name):
+    """Return (address, data) of a section of a 32-bit little endian ELF file."""
+    with open(elf_path, "rb") as elf:
+        image = elf.read()
+    if image[:4] != b"\x7fELF" or image[4] != 1 or image[5] != 1:
+        raise SystemExit("%s is not a 32-bit little endian ELF file" % elf_path)
+
+    shoff, = struct.unpack_from("<I", image, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", image, 0x2E)
+
+    def header(index):
+        return struct.unpack_from("<IIIIIIIIII", image, shoff + index * shentsize)
+
+    names_offset = header(shstrndx)[4]
+    for index in range(shnum):
+        name, _, _, address, offset, size = header(index)[:6]
+        end = image.index(b"\0", names_offset + name)
+        if image[names_offset + name:end].decode() == section_name:
+            return address, image[offset:offset + size]
+    raise SystemExit("%s has no %s section" % (elf_path, section_name))
+
+
+def extract(elf_path, table_path):
+    """Build the string table {ID: format} from the .out file."""
+    address, data = read_section(elf_path, LOG_STRINGS_SECTION)
+    strings = {}
+    start = 0
+    for position, byte in enumerate(data):
+        if byte == 0:
+            if position > start:
+                strings[str(address - LOG_STRINGS_BASE + start)] = data[start:position].decode("latin-1")
+            start = position + 1
+    with open(table_path, "w") as table:
+        json.dump({"base": LOG_STRINGS_BASE, "strings": strings}, table, indent=1)
+    print("%d format strings extracted to %s" % (len(strings), table_path))
+
+
+def format_record(text, arguments):
+    """printf-like formatting of the raw 32-bit arguments."""
+    values = iter(arguments)
+
+    def convert(match):
+        flags, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        value = next(values, 0)
+        if conversion in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return ("%" + flags + "d") % value
+        if conversion == "u":
+            return ("%" + flags + "d") % value
+        if conversion == "p":
+            return "0x%08x" % value
+        if conversion == "s":
+            return "<0x%08x>" % value
+        return ("%" + flags + conversion) % value
+
+    return FORMAT_SPEC.sub(convert, text)
+
+
+def decode(table_path, input_path, clock):
+    with open(table_path) as table:
+        strings = {int(key): value for key, value in json.load(table)["strings"].items()}
+
+    stream = sys.stdin.buffer if input_path == "-" else open(input_path, "rb")
+    output = sys.stdout
+    buffer = b""
+    last_sequence = None
+    last_timestamp = None
+    cycles_high = 0
+
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        buffer += chunk
+
+        position = 0
+        while len(buffer) - position >= LOG_RECORD_SIZE:
+            sequence, header, timestamp = struct.unpack_from("<III", buffer, position)
+            count = (header >> 16) & 0xFF
+            identifier = header & 0xFFFF
+            if (header >> 24) != LOG_HEADER_SYNC or count > LOG_MAX_ARGUMENTS or identifier not in strings:
+                # Not a record, text sent with Uart0_SendString
+                character = buffer[position:position + 1].decode("latin-1")
+                if character.isprintable() or character in "\r\n\t":
+                    output.write(character)
+                position += 1
+                continue
+
+            arguments = struct.unpack_from("<%dI" % LOG_MAX_ARGUMENTS, buffer, position + 12)[:count]
+            position += LOG_RECORD_SIZE
+
+            if last_sequence is not None and sequence != ((last_sequence + 1) & 0xFFFFFFFF):
+                output.write("--- %d records lost ---\n" % ((sequence - last_sequence - 1) & 0xFFFFFFFF))
+            last_sequence = sequence
+
+            # The DWT counter wraps every 2^32 cycles
+            if last_timestamp is not None and timestamp < last_timestamp:
+                cycles_high += 1 << 32
+            last_timestamp = timestamp
+
+            output.write("[%12.6f] %s\n" % ((cycles_high + timestamp) / clock,
+                                            format_record(strings[identifier], arguments)))
+        buffer = buffer[position:]
+        output.flush()
+
+    # Text left after the last record
+    output.write("".join(c for c in buffer.decode("latin-1") if c.isprintable() or c in "\r\n\t"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Tokenized log decoder")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    extract_parser = commands.add_parser("extract", help="extract the string table from the .out file")
+    extract_parser.add_argument("elf")
+    extract_parser.add_argument("table")
+
+    decode_parser = commands.add_parser("decode", help="decode a UART0 capture ('-' for stdin)")
+    decode_parser.add_argument("table")
+    decode_parser.add_argument("input")
+    decode_parser.add_argument("--clock", type=int, default=DEFAULT_CLOCK, help="system clock in Hz")
+
+    options = parser.parse_args()
+    if options.command == "extract":
+        extract(options.elf, options.table)
+    else:
+        decode(options.table, options.input, options.clock)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""
+[FILE NAME]      :   stack_report.py
+[DESCRIPTION]    :   Build-time worst-case stack depth of every entry point from the call graph
+[DATE CREATED]   :   OCT 16, 2026
+[AURTHOR]        :   Alaa Mekawi
+
+The frame size of every function and the calls it makes are read from the build output, the
+worst-case depth of an entry point is its frame plus the deepest path through its callees.
+
+    Target build, the TI compiler records the frame sizes and the calls in the DWARF of the .out
+    file (DW_AT_TI_max_frame_size and DW_TAG_TI_branch), dumped to XML by the object file displayer:
+        armofd -g -x --xml_indent=0 --obj_display=none --dwarf_display=none,dinfo ${ProjName}.out > ${ProjName}.ofd.xml
+        python tools/stack_report.py --isr SwTimer_SysTickHandler --assume PendSV_Handler=8 \
+               --call PendSV_Handler=Deferred_ProcessWork ofd ${ProjName}.ofd.xml
+
+    Host simulation build (ARM_Final_Project_Sim, make stack-report), GCC writes one .ci file per
+    source with -fcallgraph-info=su:
+        python tools/stack_report.py gcc build/*.ci
+
+The handlers (<name>_Handler, <name>ISR) run on the main stack and can nest, the sum of their
+depths plus one exception frame each is an upper bound of the main stack (STACK_MAIN_BYTES in
+Stack.h) once the kernel runs, main uses it before. The tasks (<name>_Task) run on their own
+stacks, which also hold the exception frame of the first interrupt. Compare with the high-water
+marks printed by Stack_Dump.
+
+Functions without a frame size (assembly, run-time library) and indirect calls can't be followed,
+they are flagged and can be given with --assume NAME=BYTES and --call CALLER=CALLEE, or left out
+of the report with --exclude REGEX.
+"""
+import argparse
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+# Exception frame with the FPU state (S0-S15, FPSCR and the alignment word), the kernel tasks use the FPU
+EXCEPTION_FRAME_BYTES = 104
+
+HANDLER_PATTERN = re.compile(r"(_Handler|ISR)$")
+TASK_PATTERN = re.compile(r"(_Task|_IdleTask)$")
+
+INDIRECT_CALL = "<indirect>"
+
+
+class Function:
+    def __init__(self, name):
+        self.name = name
+        self.frame = None
+        self.dynamic = False
+        self.callees = set()
+        self.excluded = False
+
+
+def get_function(graph, key, name):
+    if key not in graph:
+        graph[key] = Function(name)
+    return graph[key]
+
+
+def read_gcc(paths):
+    """Call graph from the .ci files of -fcallgraph-info=su (VCG format)."""
+    node = re.compile(r'node: \{ title: "([^"]+)" label: "([^"\\]+)(?:\\n[^"\\]*)?(?:\\n(\d+) bytes \(([a-z,]+)\))?"')
+    edge = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+    graph = {}
+    for path in paths:
+        with open(path) as ci:
+            for line in ci:
+                match = node.match(line)
+                if match:
+                    title, name, size, qualifier = match.groups()
+                    function = get_function(graph, title, name)
+                    if size is not None:
+                        function.frame = int(size)
+                        function.dynamic = qualifier != "static"
+                    continue
+                match = edge.match(line)
+                if match:
+                    source, target = match.groups()
+                    if target == "__indirect_call":
+                        target = INDIRECT_CALL
+                    get_function(graph, source, source.split(":")[-1]).callees.add(target)
+    graph.pop("__indirect_call", None)
+    return graph
+
+
+def read_ofd(path):
+    """Call graph from the DWARF of the .out file dumped by armofd -g -x."""
+    def attributes(die):
+        values = {}
+        for attribute in die.findall("attribute"):
+            value = attribute.find("value")
+            if value is not None and len(value):
+                values[attribute.findtext("type")] = value[0].text
+        return values
+
+    def branches(die):
+        # Calls made by the function, lexical blocks included but not the nested functions
+        for child in die.findall("die"):
+            tag = child.findtext("tag")
+            if tag == "DW_TAG_TI_branch":
+                yield attributes(child)
+            elif tag != "DW_TAG_subprogram":
+                for branch in branches(child):
+                    yield branch
+
+    graph = {}
+    for die in ElementTree.parse(path).iter("die"):
+        if die.findtext("tag") != "DW_TAG_subprogram":
+            continue
+        values = attributes(die)
+        name = values.get("DW_AT_name")
+        if name is None or "DW_AT_TI_max_frame_size" not in values:
+            continue
+        # A static function of the same name in two files is merged, the report stays an upper bound
+        function = get_function(graph, name, name)
+        function.frame = max(function.frame or 0, int(values["DW_AT_TI_max_frame_size"], 0))
+        for branch in branches(die):
+            if "DW_AT_TI_indirect" in branch:
+                function.callees.add(INDIRECT_CALL)
+            elif "DW_AT_name" in branch:
+                function.callees.add(branch["DW_AT_name"])
+    return graph
+
+
+def worst_case(graph, key, path, notes, cache):
+    """Deepest path from a function, returns (bytes, [keys])."""
+    if key in cache:
+        return cache[key]
+    if key in graph and graph[key].excluded:
+        return 0, []
+    if key == INDIRECT_CALL:
+        notes.add("indirect call")
+        return 0, [INDIRECT_CALL]
+    if key in path:
+        notes.add("recursion in " + graph[key].name)
+        return 0, []
+
+    function = graph.get(key)
+    if function is None or function.frame is None:
+        notes.add("no frame size for " + (function.name if function else key))
+        return 0, [key]
+    if function.dynamic:
+        notes.add("dynamic frame in " + function.name)
+
+    deepest, deepest_path = 0, []
+    for callee in sorted(function.callees):
+        depth, callee_path = worst_case(graph, callee, path | {key}, notes, cache)
+        if depth > deepest or not deepest_path:
+            deepest, deepest_path = depth, callee_path
+    result = (function.frame + deepest, [key] + deepest_path)
+    cache[key] = result
+    return result
+
+
+def report(graph, arguments):
+    for assumption in arguments.assume:
+        name, size = assumption.split("=")
+        get_function(graph, name, name).frame = int(size, 0)
+    for call in arguments.call:
+        caller, callee = call.split("=")
+        get_function(graph, caller, caller).callees.add(callee)
+
+    if arguments.exclude:
+        excluded = re.compile(arguments.exclude)
+        for function in list(graph.values()):
+            for callee in function.callees:
+                get_function(graph, callee, callee.split(":")[-1])
+        for function in graph.values():
+            function.excluded = excluded.search(function.name) is not None
+
+    names = dict((key, function.name) for key, function in graph.items())
+    handlers = sorted(key for key in graph if HANDLER_PATTERN.search(names[key]) or names[key] in arguments.isr)
+    tasks = sorted(key for key in graph if TASK_PATTERN.search(names[key]) or names[key] in arguments.task)
+    threads = sorted(key for key in graph if names[key] == "main" or names[key] in arguments.thread)
+
+    frame = arguments.frame
+    handlers_total = 0
+    print("%-28s %6s %6s  %s" % ("Entry point", "Depth", "Stack", "Worst path"))
+    for title, keys, exception_frame in (("Handlers (main stack)", handlers, frame),
+                                         ("Tasks (own stack)", tasks, frame),
+                                         ("Thread mode", threads, 0)):
+        if not keys:
+            continue
+        print("-- %s" % title)
+        for key in keys:
+            notes = set()
+            depth, path = worst_case(graph, key, frozenset(), notes, {})
+            if keys is handlers:
+                handlers_total += depth + exception_frame
+            print("%-28s %6d %6d  %s" % (names[key], depth, depth + exception_frame,
+                                         " > ".join(names.get(step, step) for step in path)))
+            for note in sorted(notes):
+                print("%-28s %6s %6s  ! %s" % ("", "", "", note))
+
+    main_depth = max([worst_case(graph, key, frozenset(), set(), {})[0] for key in threads] or [0])
+    print("")
+    print("Main stack upper bound: %d bytes (main %d + all the handlers nested %d, %d bytes per exception frame)"
+          % (main_depth + handlers_total, main_depth, handlers_total, frame))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--frame", type=int, default=EXCEPTION_FRAME_BYTES,
+                        help="bytes stacked by an exception entry (default %(default)s, 32 without the FPU)")
+    parser.add_argument("--isr", action="append", default=[], metavar="NAME", help="add a handler entry point")
+    parser.add_argument("--task", action="append", default=[], metavar="NAME", help="add a task entry point")
+    parser.add_argument("--thread", action="append", default=[], metavar="NAME",
+                        help="add a thread mode entry point running on the main stack (main is one)")
+    parser.add_argument("--assume", action="append", default=[], metavar="NAME=BYTES",
+                        help="frame size of a function without one (e.g. PendSV_Handler=40)")
+    parser.add_argument("--call", action="append", default=[], metavar="CALLER=CALLEE",
+                        help="call not in the graph (assembly caller or indirect call)")
+    parser.add_argument("--exclude", metavar="REGEX", help="functions counted as 0 bytes without a note")
+    commands = parser.add_subparsers(dest="command", required=True)
+    ofd = commands.add_parser("ofd", help="TI build, XML of armofd -g -x")
+    ofd.add_argument("xml")
+    gcc = commands.add_parser("gcc", help="GCC build, .ci files of -fcallgraph-info=su")
+    gcc.add_argument("ci", nargs="+")
+    arguments = parser.parse_args()
+
+    if arguments.command == "ofd":
+        graph = read_ofd(arguments.xml)
+    else:
+        graph = read_gcc(arguments.ci)
+    if not graph:
+        sys.exit("no function found")
+    report(graph, arguments)
+
+
+if __name__ == "__main__":
+    main()